@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "src/ssd1306.h"
+#include "src/matrix.h"
+#include "src/ws2812.h"
+#include "src/scroller.h"
+#include "host_sdk.h"
+
+// Micro-benchmarks do código de desenho e dos drivers, rodando no host.
+// Cada caso roda em lotes até somar BENCH_MIN_NS; o resultado é o melhor de
+// BENCH_ROUNDS rodadas, o que deixa os números comparáveis entre commits.
+// "bytes/op" é o que iria para o barramento (I2C do display ou bits da
+// matriz), independente da velocidade da máquina.
+
+#define BENCH_ROUNDS 7
+#define BENCH_MIN_NS 50000000ull // 50 ms por rodada
+
+static ssd1306_t ssd;
+static scroller_t scroller;
+static uint32_t frame[MATRIX_LEDS];
+static volatile uint32_t sink; // Impede que o compilador descarte o trabalho
+
+typedef struct {
+  const char *name;
+  void (*run)(uint32_t i);
+  void (*setup)(void);
+} bench_t;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Esvazia o que ficou pendente sem contar o tráfego
+static void settle(void) {
+  host_bus_t saved = host_bus;
+  ssd1306_send_data(&ssd);
+  host_bus = saved;
+}
+
+static void run_fill(uint32_t i) {
+  ssd1306_fill(&ssd, i & 1);
+}
+
+static void run_rect(uint32_t i) {
+  ssd1306_rect(&ssd, 3 + (i & 7), 5, 100, 40, true, false);
+}
+
+static void run_rect_fill(uint32_t i) {
+  ssd1306_rect(&ssd, 3 + (i & 7), 5, 100, 40, i & 1, true);
+}
+
+static void run_line(uint32_t i) {
+  ssd1306_line(&ssd, 0, i & 63, 127, 63 - (i & 63), true);
+}
+
+static void run_string(uint32_t i) {
+  ssd1306_draw_string(&ssd, "Tempo: 123 s", 10, 30);
+}
+
+static void run_string_unaligned(uint32_t i) {
+  ssd1306_draw_string(&ssd, "Tempo: 123 s", 10, 27);
+}
+
+static void run_flush_full(uint32_t i) {
+  ssd1306_send_data_full(&ssd);
+}
+
+// Um campo de texto que muda a cada vez: só a caixa alterada é enviada
+static void run_flush_field(uint32_t i) {
+  char text[16];
+  snprintf(text, sizeof(text), "Tempo: %3u s", (unsigned)(i % 1000));
+  ssd1306_draw_string(&ssd, text, 20, 30);
+  ssd1306_send_data(&ssd);
+}
+
+// Um passo da rolagem pela start line, com a página nova a cada 8 passos
+static void run_scroll(uint32_t i) {
+  scroller_step(&scroller);
+  ssd1306_send_data(&ssd);
+}
+
+static void setup_scroll(void) {
+  static const char *const lines[] = { "Gire os ombros", "para tras,", "bem devagar", "", "Tempo: %d" };
+  scroller_start(&scroller, &ssd, lines, 5, 10);
+}
+
+// Um ponto que anda pela matriz: desenho nas camadas, composição e envio
+static void run_matrix(uint32_t i) {
+  while (ws2812_busy())
+    tight_loop_contents(); // O relógio virtual pula para o fim do quadro anterior
+  matrix_clear(2);
+  matrix_set(2, i % MATRIX_WIDTH, (i / MATRIX_WIDTH) % MATRIX_HEIGHT, 0, 128, 0);
+  matrix_compose(frame);
+  ws2812_show(frame, MATRIX_LEDS);
+  sink += frame[0];
+}
+
+static void setup_matrix(void) {
+  matrix_clear(0);
+  matrix_clear(1);
+  matrix_set(1, 2, 2, 128, 0, 0);
+}
+
+static const bench_t benches[] = {
+  { "fill", run_fill, NULL },
+  { "rect", run_rect, NULL },
+  { "rect_fill", run_rect_fill, NULL },
+  { "line", run_line, NULL },
+  { "draw_string", run_string, NULL },
+  { "draw_string_y27", run_string_unaligned, NULL },
+  { "flush_full", run_flush_full, NULL },
+  { "flush_field", run_flush_field, NULL },
+  { "scroll_step", run_scroll, setup_scroll },
+  { "matrix_update", run_matrix, setup_matrix },
+};
+
+static void bench_run(const bench_t *b) {
+  double best_ns = 0;
+  double bytes_per_op = 0;
+
+  if (b->setup)
+    b->setup();
+  for (uint r = 0; r < BENCH_ROUNDS; ++r) {
+    settle();
+    host_bus_t before = host_bus;
+    uint64_t ops = 0;
+    uint64_t start = now_ns(), elapsed;
+    do {
+      for (uint32_t i = 0; i < 64; ++i)
+        b->run((uint32_t)ops + i);
+      ops += 64;
+      elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+
+    double ns = (double)elapsed / ops;
+    if (r == 0 || ns < best_ns)
+      best_ns = ns;
+    uint64_t i2c = host_bus.i2c_bytes - before.i2c_bytes;
+    uint64_t led = (host_bus.pio_words - before.pio_words) * 3; // 24 bits por LED
+    bytes_per_op = (double)(i2c + led) / ops;
+  }
+  printf("%-18s %12.1f %12.1f\n", b->name, best_ns, bytes_per_op);
+}
+
+int main(int argc, char **argv) {
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+  ssd1306_config(&ssd);
+  ws2812_init(7);
+
+  printf("%-18s %12s %12s\n", "benchmark", "ns/op", "bytes/op");
+  for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); ++i) {
+    if (argc > 1 && strstr(benches[i].name, argv[1]) == NULL)
+      continue; // Filtro opcional pelo nome
+    bench_run(&benches[i]);
+  }
+  return 0;
+}
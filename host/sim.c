@@ -0,0 +1,326 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "host_sdk.h"
+#include "hardware/flash.h"
+#include "ssd1306_model.h"
+
+// Simulador do firmware inteiro no host. O main() de projeto_final.c roda
+// sobre o SDK de host/stubs com relógio virtual: quando o firmware dorme em
+// __wfi(), o relógio pula direto para o próximo alarme ou para a próxima
+// linha do roteiro de entradas. Um ciclo completo (minutos de uso real)
+// roda em milissegundos e sempre produz a mesma sequência de quadros.
+//
+//   sim <roteiro> [pasta] [flash.bin]
+//
+// Na pasta (padrão sim-out) ficam um PBM por quadro diferente do display,
+// um PPM por quadro diferente da matriz e quadros.txt, com o instante
+// virtual de cada quadro e de cada mudança do LED e do buzzer. Dois runs
+// podem ser comparados com diff -r: mudança de conteúdo aparece nas imagens,
+// mudança de tempo em quadros.txt. Com flash.bin, a flash começa com o
+// conteúdo do arquivo (se existir) e é gravada nele no fim: o próximo run
+// é um reinício da placa, com a configuração e o histórico salvos.
+//
+// Roteiro: uma ação por linha, "tempo comando argumentos", com o tempo em
+// segundos (absoluto, ou relativo à linha anterior com +). # comenta.
+//   1.0    botao A [ms]          aperta A, B ou J (joystick) por ms (padrão 100)
+//   +0.5   joystick <x> <y>      leitura crua dos eixos (0..4095, centro 2048)
+//   30     usb <caractere>       caractere recebido pela USB (ex.: p)
+//   130    fim                   encerra (sem fim, encerra na última linha)
+
+int firmware_main(void);
+
+// Mesmos pinos de projeto_final.c
+#define PIN_BUTTON_A 5
+#define PIN_BUTTON_B 6
+#define PIN_BUTTON_J 22
+#define PIN_BUZZER 10
+#define PIN_LED 13
+#define OLED_ADDR 0x3C
+#define ADC_AXIS_X 1
+#define ADC_AXIS_Y 0
+
+#define SCRIPT_MAX 1024
+#define MATRIX_LEDS 25
+
+typedef enum { ACTION_PRESS, ACTION_RELEASE, ACTION_JOYSTICK, ACTION_USB, ACTION_END } action_type_t;
+
+typedef struct {
+  uint64_t time_us;
+  action_type_t type;
+  int a, b;
+} action_t;
+
+static action_t script[SCRIPT_MAX];
+static uint script_len, script_pos;
+
+static const char *out_dir;
+static const char *flash_path;
+static FILE *index_file;
+static uint oled_frames, matrix_frames;
+static uint8_t oled_last[SSD1306_MODEL_WIDTH * SSD1306_MODEL_HEIGHT];
+static uint32_t matrix_last[MATRIX_LEDS];
+static bool matrix_captured;
+
+// (x, y) lógico → posição no cabo, como em src/matrix.c (y = 0 embaixo)
+static const uint8_t matrix_index[5][5] = {
+  { 20, 21, 22, 23, 24 },
+  { 19, 18, 17, 16, 15 },
+  { 10, 11, 12, 13, 14 },
+  {  9,  8,  7,  6,  5 },
+  {  0,  1,  2,  3,  4 },
+};
+
+static void fail(const char *msg, const char *detail) {
+  fprintf(stderr, "sim: %s%s%s\n", msg, detail ? ": " : "", detail ? detail : "");
+  exit(1);
+}
+
+static double now_s(void) {
+  return time_us_64() / 1e6;
+}
+
+// --- Roteiro ---
+
+static void script_add(uint64_t time_us, action_type_t type, int a, int b) {
+  if (script_len >= SCRIPT_MAX)
+    fail("roteiro longo demais", NULL);
+  script[script_len++] = (action_t){ time_us, type, a, b };
+}
+
+static int button_pin(const char *name) {
+  if (strcmp(name, "A") == 0)
+    return PIN_BUTTON_A;
+  if (strcmp(name, "B") == 0)
+    return PIN_BUTTON_B;
+  if (strcmp(name, "J") == 0)
+    return PIN_BUTTON_J;
+  return -1;
+}
+
+static int compare_actions(const void *pa, const void *pb) {
+  const action_t *a = pa, *b = pb;
+  if (a->time_us != b->time_us)
+    return a->time_us < b->time_us ? -1 : 1;
+  return a < b ? -1 : 1; // Estável: mantém a ordem do arquivo
+}
+
+static void script_load(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f)
+    fail("não abriu o roteiro", path);
+
+  char line[256];
+  uint lineno = 0;
+  uint64_t previous = 0;
+  while (fgets(line, sizeof(line), f)) {
+    lineno++;
+    char *comment = strchr(line, '#');
+    if (comment)
+      *comment = '\0';
+
+    char when[32], command[32], arg1[32] = "", arg2[32] = "";
+    int n = sscanf(line, "%31s %31s %31s %31s", when, command, arg1, arg2);
+    if (n <= 0)
+      continue;
+    char *end;
+    double s = strtod(when[0] == '+' ? when + 1 : when, &end);
+    if (n < 2 || *end || s < 0) {
+      fprintf(stderr, "sim: %s:%u: linha inválida\n", path, lineno);
+      exit(1);
+    }
+    uint64_t t = (uint64_t)(s * 1e6 + 0.5) + (when[0] == '+' ? previous : 0);
+    previous = t;
+
+    if (strcmp(command, "botao") == 0) {
+      int pin = button_pin(arg1);
+      int ms = n >= 4 ? atoi(arg2) : 100;
+      if (pin < 0 || ms <= 0) {
+        fprintf(stderr, "sim: %s:%u: botão deve ser A, B ou J\n", path, lineno);
+        exit(1);
+      }
+      script_add(t, ACTION_PRESS, pin, 0);
+      script_add(t + ms * 1000ull, ACTION_RELEASE, pin, 0);
+    } else if (strcmp(command, "joystick") == 0 && n == 4) {
+      script_add(t, ACTION_JOYSTICK, atoi(arg1), atoi(arg2));
+    } else if (strcmp(command, "usb") == 0 && n >= 3) {
+      script_add(t, ACTION_USB, (unsigned char)arg1[0], 0);
+    } else if (strcmp(command, "fim") == 0) {
+      script_add(t, ACTION_END, 0, 0);
+    } else {
+      fprintf(stderr, "sim: %s:%u: comando desconhecido '%s'\n", path, lineno, command);
+      exit(1);
+    }
+  }
+  fclose(f);
+
+  qsort(script, script_len, sizeof(action_t), compare_actions);
+  if (script_len == 0 || script[script_len - 1].type != ACTION_END)
+    script_add(script_len ? script[script_len - 1].time_us : 0, ACTION_END, 0, 0);
+}
+
+static void flash_load(void) {
+  FILE *f = fopen(flash_path, "rb");
+  if (!f)
+    return; // Primeira vez: flash apagada
+  if (fread(host_flash, 1, sizeof(host_flash), f) != sizeof(host_flash))
+    fail("imagem da flash incompleta", flash_path);
+  fclose(f);
+}
+
+static void flash_save(void) {
+  FILE *f = fopen(flash_path, "wb");
+  if (!f || fwrite(host_flash, 1, sizeof(host_flash), f) != sizeof(host_flash))
+    fail("não gravou a imagem da flash", flash_path);
+  fclose(f);
+}
+
+static void finish(void) {
+  fprintf(index_file, "%.6f fim\n", now_s());
+  fclose(index_file);
+  if (flash_path)
+    flash_save();
+  fprintf(stderr, "sim: %.3f s virtuais, %u quadros do display, %u da matriz, em %s\n",
+          now_s(), oled_frames, matrix_frames, out_dir);
+  fflush(stdout);
+  exit(0);
+}
+
+static void apply(const action_t *action) {
+  switch (action->type) {
+    case ACTION_PRESS:
+      host_gpio_set(action->a, false); // Ativo em nível baixo
+      break;
+    case ACTION_RELEASE:
+      host_gpio_set(action->a, true);
+      break;
+    case ACTION_JOYSTICK:
+      host_adc_set(ADC_AXIS_X, action->a);
+      host_adc_set(ADC_AXIS_Y, action->b);
+      break;
+    case ACTION_USB:
+      host_stdin_push(action->a);
+      break;
+    case ACTION_END:
+      finish();
+  }
+}
+
+// __wfi(): roda o que vier primeiro, o próximo alarme ou a próxima ação
+static void idle(void) {
+  uint64_t next_event = host_next_event_us();
+  const action_t *action = &script[script_pos];
+  if (action->time_us <= next_event) {
+    host_run_until(action->time_us);
+    script_pos++;
+    apply(action);
+  } else {
+    host_run_until(next_event);
+  }
+}
+
+// --- Captura ---
+
+static FILE *open_frame(const char *name) {
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%s", out_dir, name);
+  FILE *f = fopen(path, "w");
+  if (!f)
+    fail("não criou o quadro", path);
+  return f;
+}
+
+static void oled_write(uint index, uint8_t addr, const uint8_t *src, size_t len) {
+  if (addr == OLED_ADDR)
+    ssd1306_model_write(src, len);
+}
+
+// Fim de um envio ao display: um quadro novo se a imagem mudou (PBM texto)
+static void oled_done(uint index) {
+  uint8_t pixels[SSD1306_MODEL_WIDTH * SSD1306_MODEL_HEIGHT];
+  ssd1306_model_render(pixels);
+  if (oled_frames && memcmp(pixels, oled_last, sizeof(pixels)) == 0)
+    return;
+  memcpy(oled_last, pixels, sizeof(pixels));
+
+  char name[32];
+  snprintf(name, sizeof(name), "oled_%04u.pbm", ++oled_frames);
+  FILE *f = open_frame(name);
+  fprintf(f, "P1\n%d %d\n", SSD1306_MODEL_WIDTH, SSD1306_MODEL_HEIGHT);
+  for (uint y = 0; y < SSD1306_MODEL_HEIGHT; ++y) {
+    for (uint x = 0; x < SSD1306_MODEL_WIDTH; ++x)
+      fputc('0' + pixels[y * SSD1306_MODEL_WIDTH + x], f);
+    fputc('\n', f);
+  }
+  fclose(f);
+  fprintf(index_file, "%.6f oled %s\n", now_s(), name);
+}
+
+// Um quadro da matriz (uma transferência de 25 palavras GRB para o PIO)
+static void matrix_frame(uint sm, const uint32_t *words, uint count) {
+  if (count != MATRIX_LEDS)
+    return;
+  if (matrix_captured && memcmp(words, matrix_last, sizeof(matrix_last)) == 0)
+    return;
+  memcpy(matrix_last, words, sizeof(matrix_last));
+  matrix_captured = true;
+
+  char name[32];
+  snprintf(name, sizeof(name), "matriz_%04u.ppm", ++matrix_frames);
+  FILE *f = open_frame(name);
+  fprintf(f, "P3\n5 5\n255\n");
+  for (int y = 4; y >= 0; --y) {
+    for (uint x = 0; x < 5; ++x) {
+      uint32_t grb = words[matrix_index[y][x]];
+      fprintf(f, "%s%3u %3u %3u", x ? "  " : "", (grb >> 16) & 0xFF, grb >> 24, (grb >> 8) & 0xFF);
+    }
+    fputc('\n', f);
+  }
+  fclose(f);
+  fprintf(index_file, "%.6f matriz %s\n", now_s(), name);
+}
+
+static void gpio_out(uint gpio, bool value) {
+  if (gpio == PIN_LED)
+    fprintf(index_file, "%.6f led %d\n", now_s(), value);
+}
+
+static void pwm_level(uint gpio, uint16_t level) {
+  if (gpio == PIN_BUZZER)
+    fprintf(index_file, "%.6f buzzer %u\n", now_s(), level);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2 || argc > 4) {
+    fprintf(stderr, "uso: %s <roteiro> [pasta] [flash.bin]\n", argv[0]);
+    return 2;
+  }
+  out_dir = argc > 2 ? argv[2] : "sim-out";
+  flash_path = argc > 3 ? argv[3] : NULL;
+  if (mkdir(out_dir, 0755) != 0 && errno != EEXIST)
+    fail("não criou a pasta", out_dir);
+
+  script_load(argv[1]);
+  if (flash_path)
+    flash_load();
+
+  char path[512];
+  snprintf(path, sizeof(path), "%s/quadros.txt", out_dir);
+  index_file = fopen(path, "w");
+  if (!index_file)
+    fail("não criou o índice", path);
+
+  ssd1306_model_reset();
+  host_hooks = (host_hooks_t){
+    .idle = idle,
+    .i2c_write = oled_write,
+    .i2c_done = oled_done,
+    .pio_write = matrix_frame,
+    .gpio_out = gpio_out,
+    .pwm_level = pwm_level,
+  };
+
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  return firmware_main();
+}
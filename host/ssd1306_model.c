@@ -0,0 +1,147 @@
+#include "ssd1306_model.h"
+#include <string.h>
+
+#define PAGES (SSD1306_MODEL_HEIGHT / 8)
+
+static uint8_t gddram[SSD1306_MODEL_WIDTH][PAGES];
+static uint8_t addr_mode;  // 0 horizontal, 1 vertical, 2 página
+static uint8_t col0, col1, page0, page1, col, page;
+static uint8_t start_line, offset, mux;
+static bool display_on, inverted, entire_on, seg_remap, com_remap;
+
+// Comando em andamento: alguns levam bytes de argumento
+static uint8_t cmd[8];
+static uint8_t cmd_len;
+
+void ssd1306_model_reset(void) {
+  memset(gddram, 0, sizeof(gddram));
+  addr_mode = 2;
+  col0 = col = 0;
+  col1 = SSD1306_MODEL_WIDTH - 1;
+  page0 = page = 0;
+  page1 = PAGES - 1;
+  start_line = offset = 0;
+  mux = SSD1306_MODEL_HEIGHT;
+  display_on = inverted = entire_on = seg_remap = com_remap = false;
+  cmd_len = 0;
+}
+
+// Comandos da rolagem contínua (26/27/29/2A/2E/2F/A3) são aceitos, mas a
+// imagem não anda: o modelo não tem relógio de quadros
+static uint8_t command_args(uint8_t c) {
+  switch (c) {
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x26: case 0x27:
+      return 6;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x20: case 0x81: case 0x8D: case 0xA8:
+    case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+static void command_byte(uint8_t b) {
+  cmd[cmd_len++] = b;
+  if (cmd_len <= command_args(cmd[0]))
+    return;
+  cmd_len = 0;
+
+  uint8_t c = cmd[0];
+  if (c == 0x20) {
+    addr_mode = cmd[1] & 3;
+  } else if (c == 0x21) {
+    col0 = col = cmd[1] & 0x7F;
+    col1 = cmd[2] & 0x7F;
+  } else if (c == 0x22) {
+    page0 = page = cmd[1] & 7;
+    page1 = cmd[2] & 7;
+  } else if (c >= 0x40 && c <= 0x7F) {
+    start_line = c & 0x3F;
+  } else if (c == 0xA8) {
+    mux = (cmd[1] & 0x3F) + 1;
+    if (mux < 16)
+      mux = SSD1306_MODEL_HEIGHT; // Valores abaixo de 15 são inválidos e ignorados
+  } else if (c == 0xD3) {
+    offset = cmd[1] & 0x3F;
+  } else if (c == 0xA0 || c == 0xA1) {
+    seg_remap = c & 1;
+  } else if (c == 0xC0 || c == 0xC8) {
+    com_remap = c & 8;
+  } else if (c == 0xA4 || c == 0xA5) {
+    entire_on = c & 1;
+  } else if (c == 0xA6 || c == 0xA7) {
+    inverted = c & 1;
+  } else if (c == 0xAE || c == 0xAF) {
+    display_on = c & 1;
+  } else if (addr_mode == 2 && c >= 0xB0 && c <= 0xB7) {
+    page = c & 7;
+  } else if (addr_mode == 2 && c <= 0x0F) {
+    col = (col & 0xF0) | c;
+  } else if (addr_mode == 2 && c >= 0x10 && c <= 0x17) {
+    col = (col & 0x0F) | (c & 7) << 4;
+  }
+}
+
+static void data_byte(uint8_t b) {
+  gddram[col][page] = b;
+  if (addr_mode == 1) {
+    if (page++ >= page1) {
+      page = page0;
+      col = col >= col1 ? col0 : col + 1;
+    }
+  } else if (addr_mode == 0) {
+    if (col++ >= col1) {
+      col = col0;
+      page = page >= page1 ? page0 : page + 1;
+    }
+  } else if (col < SSD1306_MODEL_WIDTH - 1) {
+    col++;
+  }
+}
+
+// Byte de controle: Co (bit 7) = só um byte segue antes do próximo controle;
+// D/C (bit 6) = dados na GDDRAM em vez de comandos
+void ssd1306_model_write(const uint8_t *src, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    uint8_t control = src[i++];
+    bool data = control & 0x40;
+    size_t end = (control & 0x80) ? i + 1 : len;
+    if (end > len)
+      end = len;
+    for (; i < end; ++i) {
+      if (data)
+        data_byte(src[i]);
+      else
+        command_byte(src[i]);
+    }
+  }
+}
+
+// A orientação do driver (A1 + C8) é a "de pé"; sem o remap, a imagem espelha.
+// A linha y do painel é a saída COM[63 - y]; com MUX < 64 só COM0..MUX-1 são
+// acionadas e, no modo remapeado (C8), a linha 0 da imagem sai em COM[MUX-1].
+void ssd1306_model_render(uint8_t *pixels) {
+  for (uint8_t y = 0; y < SSD1306_MODEL_HEIGHT; ++y) {
+    int com = SSD1306_MODEL_HEIGHT - 1 - y;
+    int row = com_remap ? mux - 1 - com : com;
+    if (row < 0 || row >= mux) {
+      memset(&pixels[y * SSD1306_MODEL_WIDTH], 0, SSD1306_MODEL_WIDTH);
+      continue;
+    }
+    uint8_t line = (row + start_line + offset) % SSD1306_MODEL_HEIGHT;
+    for (uint8_t x = 0; x < SSD1306_MODEL_WIDTH; ++x) {
+      uint8_t column = seg_remap ? x : SSD1306_MODEL_WIDTH - 1 - x;
+      bool on = (gddram[column][line >> 3] >> (line & 7)) & 1;
+      if (entire_on)
+        on = true;
+      if (inverted)
+        on = !on;
+      pixels[y * SSD1306_MODEL_WIDTH + x] = display_on && on;
+    }
+  }
+}
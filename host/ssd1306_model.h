@@ -0,0 +1,20 @@
+#ifndef SSD1306_MODEL_H
+#define SSD1306_MODEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Modelo do controlador SSD1306 (128x64) para o simulador: interpreta as
+// transações I2C recebidas pelo display e mantém a GDDRAM e o estado dos
+// comandos que afetam a imagem.
+
+#define SSD1306_MODEL_WIDTH 128
+#define SSD1306_MODEL_HEIGHT 64
+
+void ssd1306_model_reset(void);
+void ssd1306_model_write(const uint8_t *src, size_t len); // Uma transação (controle + bytes)
+// Imagem como aparece no painel: um byte por pixel (1 = aceso), linha a linha
+void ssd1306_model_render(uint8_t *pixels);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef HOST_HARDWARE_ADC_H
+#define HOST_HARDWARE_ADC_H
+
+#include "pico/stdlib.h"
+
+// O ADC não converte de verdade: o anel do DMA que lê o FIFO é preenchido
+// com os valores de host_adc_set(), na ordem do round-robin
+typedef struct {
+  volatile uint32_t cs, result, fcs, fifo, div;
+} adc_hw_t;
+
+extern adc_hw_t *const adc_hw;
+
+#define DREQ_ADC 36
+
+static inline void adc_init(void) {}
+static inline void adc_gpio_init(uint gpio) {}
+void adc_select_input(uint input);
+void adc_set_round_robin(uint input_mask);
+static inline void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift) {}
+static inline void adc_set_clkdiv(float clkdiv) {}
+void adc_run(bool run);
+uint16_t adc_read(void);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef HOST_HARDWARE_CLOCKS_H
+#define HOST_HARDWARE_CLOCKS_H
+
+#include "pico/stdlib.h"
+
+#define HOST_CLK_SYS_HZ 125000000u
+
+enum clock_index { clk_gpout0 = 0, clk_ref = 4, clk_sys = 5, clk_peri = 6, clk_usb = 7, clk_adc = 8, clk_rtc = 9 };
+
+// Só os registradores de clock no sono, usados por src/power.c
+typedef struct {
+  volatile uint32_t sleep_en0, sleep_en1;
+} clocks_hw_t;
+
+extern clocks_hw_t *const clocks_hw;
+
+#define CLOCKS_SLEEP_EN0_CLK_ADC_ADC_BITS (1u << 1)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_ADC_BITS (1u << 2)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_I2C0_BITS (1u << 6)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_JTAG_BITS (1u << 9)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_PIO0_BITS (1u << 12)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_PIO1_BITS (1u << 13)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_PWM_BITS (1u << 17)
+#define CLOCKS_SLEEP_EN0_CLK_RTC_RTC_BITS (1u << 21)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_RTC_BITS (1u << 22)
+#define CLOCKS_SLEEP_EN0_CLK_PERI_SPI0_BITS (1u << 24)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_SPI0_BITS (1u << 25)
+#define CLOCKS_SLEEP_EN0_CLK_PERI_SPI1_BITS (1u << 26)
+#define CLOCKS_SLEEP_EN0_CLK_SYS_SPI1_BITS (1u << 27)
+#define CLOCKS_SLEEP_EN1_CLK_SYS_TBMAN_BITS (1u << 4)
+#define CLOCKS_SLEEP_EN1_CLK_PERI_UART0_BITS (1u << 6)
+#define CLOCKS_SLEEP_EN1_CLK_SYS_UART0_BITS (1u << 7)
+#define CLOCKS_SLEEP_EN1_CLK_PERI_UART1_BITS (1u << 8)
+#define CLOCKS_SLEEP_EN1_CLK_SYS_UART1_BITS (1u << 9)
+
+static inline uint32_t clock_get_hz(enum clock_index clk_index) {
+  return clk_index == clk_sys ? HOST_CLK_SYS_HZ : 48000000u;
+}
+
+#endif
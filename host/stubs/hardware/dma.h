@@ -0,0 +1,74 @@
+#ifndef HOST_HARDWARE_DMA_H
+#define HOST_HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+// DMA com o tempo de barramento simulado: os dados chegam ao destino (I2C,
+// PIO, PWM) quando a transferência começa, e ela fica ocupada pelo tempo que
+// levaria no hardware. No fim vêm a IRQ do canal e o encadeamento.
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+#define NUM_DMA_CHANNELS 12
+#define DMA_CH0_CTRL_TRIG_EN_BITS 0x00000001u
+
+typedef struct {
+  enum dma_channel_transfer_size size;
+  uint dreq;
+  uint chain_to;
+  uint ring_bits;
+} dma_channel_config;
+
+typedef struct {
+  volatile uint32_t read_addr, write_addr, transfer_count, al1_ctrl;
+} dma_channel_hw_t;
+
+typedef struct {
+  dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+  volatile uint32_t inte0, ints0, inte1, ints1;
+  volatile uint32_t abort; // Zerado na primeira volta de tight_loop_contents()
+} dma_hw_t;
+
+extern dma_hw_t *const dma_hw;
+
+static inline void hw_set_bits(volatile uint32_t *addr, uint32_t mask) {
+  *addr |= mask;
+}
+static inline void hw_clear_bits(volatile uint32_t *addr, uint32_t mask) {
+  *addr &= ~mask;
+}
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(uint channel);
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+  c->size = size;
+}
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) {}
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) {}
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+  c->dreq = dreq;
+}
+static inline void channel_config_set_chain_to(dma_channel_config *c, uint chain_to) {
+  c->chain_to = chain_to;
+}
+static inline void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits) {
+  c->ring_bits = size_bits;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger);
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger);
+void dma_channel_start(uint channel);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_abort(uint channel);
+void dma_irqn_set_channel_enabled(uint irq_index, uint channel, bool enabled);
+
+// Timers de ritmo do DMA: X/Y do clk_sys
+int dma_claim_unused_timer(bool required);
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator);
+static inline uint dma_get_timer_dreq(uint timer) {
+  return 0x3b + timer;
+}
+
+#endif
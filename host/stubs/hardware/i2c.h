@@ -0,0 +1,42 @@
+#ifndef HOST_HARDWARE_I2C_H
+#define HOST_HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+// Registradores do bloco I2C usados pelo driver do display. Durante um envio
+// por DMA o status mostra atividade; no fim vem STOP_DET (e a IRQ, se pedida).
+typedef struct {
+  volatile uint32_t enable, tar, data_cmd, status;
+  volatile uint32_t intr_mask, raw_intr_stat, clr_stop_det, clr_tx_abrt;
+} i2c_hw_t;
+
+typedef struct {
+  i2c_hw_t *hw;
+  uint index;
+} i2c_inst_t;
+
+extern i2c_inst_t *const i2c0;
+extern i2c_inst_t *const i2c1;
+
+#define I2C_IC_DATA_CMD_STOP_BITS 0x00000200u
+#define I2C_IC_INTR_MASK_M_STOP_DET_BITS 0x00000200u
+#define I2C_IC_INTR_MASK_M_TX_ABRT_BITS 0x00000040u
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS 0x00000040u
+#define I2C_IC_RAW_INTR_STAT_STOP_DET_BITS 0x00000200u
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS 0x00000020u
+#define I2C_IC_STATUS_TFE_BITS 0x00000004u
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) {
+  return i2c->hw;
+}
+static inline uint i2c_get_index(i2c_inst_t *i2c) {
+  return i2c->index;
+}
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) {
+  return i2c->index * 2 + !is_tx;
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+#endif
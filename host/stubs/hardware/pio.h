@@ -0,0 +1,28 @@
+#ifndef HOST_HARDWARE_PIO_H
+#define HOST_HARDWARE_PIO_H
+
+#include "pico/stdlib.h"
+
+typedef struct {
+  volatile uint32_t txf[4];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+typedef struct {
+  const uint16_t *instructions;
+  uint8_t length;
+} pio_program_t;
+
+extern pio_hw_t host_pio[2];
+#define pio0 (&host_pio[0])
+#define pio1 (&host_pio[1])
+
+int pio_claim_unused_sm(PIO pio, bool required);
+uint pio_add_program(PIO pio, const pio_program_t *program);
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx) {
+  return 0;
+}
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef HOST_HARDWARE_PWM_H
+#define HOST_HARDWARE_PWM_H
+
+#include "pico/stdlib.h"
+
+// Só o nível do canal importa no host (buzzer ligado ou não)
+typedef struct {
+  uint32_t div, top;
+} pwm_config;
+
+typedef struct {
+  volatile uint32_t csr, div, ctr, cc, top;
+} pwm_slice_hw_t;
+
+typedef struct {
+  pwm_slice_hw_t slice[8];
+} pwm_hw_t;
+
+extern pwm_hw_t *const pwm_hw;
+
+static inline uint pwm_gpio_to_slice_num(uint gpio) {
+  return (gpio >> 1) & 7;
+}
+static inline uint pwm_gpio_to_channel(uint gpio) {
+  return gpio & 1;
+}
+static inline pwm_config pwm_get_default_config(void) {
+  return (pwm_config){ 16, 0xFFFF };
+}
+static inline void pwm_config_set_clkdiv(pwm_config *c, float div) {
+  c->div = (uint32_t)(div * 16);
+}
+static inline void pwm_config_set_wrap(pwm_config *c, uint16_t wrap) {
+  c->top = wrap;
+}
+void pwm_init(uint slice_num, pwm_config *c, bool start);
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract);
+void pwm_set_wrap(uint slice_num, uint16_t wrap);
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level);
+void pwm_set_gpio_level(uint gpio, uint16_t level);
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef HOST_HARDWARE_STRUCTS_SCB_H
+#define HOST_HARDWARE_STRUCTS_SCB_H
+
+#include <stdint.h>
+
+// Só o SCR, usado para o SLEEPDEEP; no host o sono é sempre o mesmo
+typedef struct {
+  volatile uint32_t scr;
+} armv6m_scb_hw_t;
+
+extern armv6m_scb_hw_t *const scb_hw;
+
+#define M0PLUS_SCR_SLEEPDEEP_BITS 0x00000004u
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef HOST_HARDWARE_SYNC_H
+#define HOST_HARDWARE_SYNC_H
+
+#include "pico/stdlib.h"
+
+// Um núcleo e nenhuma preempção: as IRQs só rodam dentro das esperas
+static inline uint32_t save_and_disable_interrupts(void) {
+  return 0;
+}
+static inline void restore_interrupts(uint32_t status) {}
+static inline void __mem_fence_acquire(void) {}
+static inline void __mem_fence_release(void) {}
+static inline void __sev(void) {}
+
+void __wfi(void);
+static inline void __wfe(void) {
+  __wfi();
+}
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_HARDWARE_TIMER_H
+#define HOST_HARDWARE_TIMER_H
+
+// time_us_64() e os alarmes ficam em pico/stdlib.h
+#include "pico/stdlib.h"
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef HOST_SDK_H
+#define HOST_SDK_H
+
+#include "pico/stdlib.h"
+
+// Controle do SDK simulado pelos programas do host: relógio virtual,
+// entradas e observação do que os drivers colocam nos barramentos.
+
+// Contadores do que os drivers colocariam nos barramentos
+typedef struct {
+  uint64_t i2c_bytes;         // Bytes de dados no I2C (sem o byte de endereço)
+  uint64_t i2c_transactions;  // START ... STOP
+  uint64_t pio_words;         // Palavras escritas no FIFO do PIO (uma por LED)
+} host_bus_t;
+
+extern host_bus_t host_bus;
+
+// Ganchos opcionais; os de saída são chamados no instante virtual do evento
+typedef struct {
+  // __wfi()/__wfe(): deve fazer algo acontecer (alarme ou entrada) e voltar.
+  // Sem gancho, o relógio pula para o próximo alarme.
+  void (*idle)(void);
+  void (*i2c_write)(uint index, uint8_t addr, const uint8_t *src, size_t len); // Uma transação
+  void (*i2c_done)(uint index);                                              // Fim de um envio
+  void (*pio_write)(uint sm, const uint32_t *words, uint count);
+  void (*gpio_out)(uint gpio, bool value);
+  void (*pwm_level)(uint gpio, uint16_t level);
+} host_hooks_t;
+
+extern host_hooks_t host_hooks;
+
+// Próximo alarme ou fim de transferência (UINT64_MAX se não há nenhum)
+uint64_t host_next_event_us(void);
+// Avança o relógio até `t_us`, disparando na ordem o que vencer no caminho
+void host_run_until(uint64_t t_us);
+
+void host_gpio_set(uint gpio, bool level); // Borda em uma entrada (gera a IRQ)
+void host_adc_set(uint input, uint16_t value);
+void host_stdin_push(int c);               // Caractere chegando pela USB
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef HOST_PICO_FLASH_H
+#define HOST_PICO_FLASH_H
+
+// Um núcleo só e nada rodando da flash: a função é chamada direto
+#include "pico/stdlib.h"
+
+static inline int flash_safe_execute(void (*func)(void *), void *param, uint32_t enter_exit_timeout_ms) {
+  func(param);
+  return PICO_OK;
+}
+
+static inline bool flash_safe_execute_core_init(void) {
+  return true;
+}
+
+#endif
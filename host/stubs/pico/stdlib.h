@@ -0,0 +1,60 @@
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+// Subconjunto do SDK do Pico usado pelo firmware compilado no host. O tempo
+// é virtual: só avança nas esperas (sleep_ms, busy_wait_us, __wfi...), que
+// disparam na ordem os alarmes e os fins de transferência vencidos.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdio.h>
+#include "hardware/gpio.h"
+
+typedef unsigned int uint;
+
+#define PICO_OK 0
+#define PICO_ERROR_TIMEOUT (-1)
+
+#define hard_assert(x) assert(x)
+
+uint64_t time_us_64(void);
+static inline uint32_t time_us_32(void) {
+  return (uint32_t)time_us_64();
+}
+void busy_wait_us(uint64_t delay_us);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+void tight_loop_contents(void);
+static inline uint get_core_num(void) {
+  return 0;
+}
+
+static inline bool stdio_init_all(void) {
+  return true;
+}
+int getchar_timeout_us(uint32_t timeout_us);
+
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+typedef struct alarm_pool alarm_pool_t;
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past);
+static inline alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+  return add_alarm_in_us(ms * 1000ull, callback, user_data, fire_if_past);
+}
+bool cancel_alarm(alarm_id_t id);
+
+// Um só relógio no host: os pools compartilham a fila de alarmes
+static inline alarm_pool_t *alarm_pool_create_with_unused_hardware_alarm(uint max_timers) {
+  return (alarm_pool_t *)1;
+}
+static inline alarm_id_t alarm_pool_add_alarm_in_us(alarm_pool_t *pool, uint64_t us, alarm_callback_t callback,
+                                                    void *user_data, bool fire_if_past) {
+  return add_alarm_in_us(us, callback, user_data, fire_if_past);
+}
+static inline bool alarm_pool_cancel_alarm(alarm_pool_t *pool, alarm_id_t id) {
+  return cancel_alarm(id);
+}
+
+#endif
@@ -0,0 +1,687 @@
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/scb.h"
+#include "host_sdk.h"
+
+// Implementação do SDK para rodar o firmware no Linux com tempo virtual.
+// Um núcleo, sem preempção: alarmes, fins de transferência e IRQs rodam
+// dentro das esperas, na ordem do relógio, então a mesma sequência de
+// entradas sempre produz a mesma sequência de saídas.
+
+host_bus_t host_bus;
+host_hooks_t host_hooks;
+
+static uint64_t now_us;
+static bool in_irq;       // Dentro de um alarme ou handler: não aninha outro
+static uint32_t irq_pending;
+
+// --- Relógio e alarmes ---
+
+#define HOST_MAX_ALARMS 32
+
+// Alarme do programa (callback) ou evento interno do hardware simulado (event)
+typedef struct {
+  alarm_id_t id;
+  uint64_t at;
+  alarm_callback_t callback;
+  void (*event)(void *arg);
+  void *user_data;
+} host_alarm_t;
+
+static host_alarm_t alarms[HOST_MAX_ALARMS];
+static alarm_id_t next_alarm_id = 1;
+
+static void irq_dispatch(void);
+
+uint64_t time_us_64(void) {
+  return now_us;
+}
+
+static alarm_id_t alarm_insert(alarm_id_t id, uint64_t at, alarm_callback_t callback, void (*event)(void *),
+                               void *user_data) {
+  for (uint i = 0; i < HOST_MAX_ALARMS; ++i) {
+    if (!alarms[i].id) {
+      if (!id) {
+        id = next_alarm_id++;
+        if (next_alarm_id <= 0)
+          next_alarm_id = 1;
+      }
+      alarms[i] = (host_alarm_t){ id, at, callback, event, user_data };
+      return id;
+    }
+  }
+  return -1;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+  return alarm_insert(0, now_us + us, callback, NULL, user_data);
+}
+
+bool cancel_alarm(alarm_id_t id) {
+  for (uint i = 0; i < HOST_MAX_ALARMS; ++i) {
+    if (id > 0 && alarms[i].id == id) {
+      alarms[i].id = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+static alarm_id_t host_schedule(uint64_t us, void (*event)(void *), void *arg) {
+  alarm_id_t id = alarm_insert(0, now_us + us, NULL, event, arg);
+  if (id < 0) {
+    fprintf(stderr, "host: sem alarmes livres para o hardware simulado\n");
+    exit(1);
+  }
+  return id;
+}
+
+// Mais cedo primeiro; empate pela ordem de criação, para ser determinístico
+static int alarm_earliest(void) {
+  int best = -1;
+  for (uint i = 0; i < HOST_MAX_ALARMS; ++i) {
+    if (!alarms[i].id)
+      continue;
+    if (best < 0 || alarms[i].at < alarms[best].at ||
+        (alarms[i].at == alarms[best].at && alarms[i].id < alarms[best].id))
+      best = i;
+  }
+  return best;
+}
+
+uint64_t host_next_event_us(void) {
+  int i = alarm_earliest();
+  return i < 0 ? UINT64_MAX : alarms[i].at;
+}
+
+void host_run_until(uint64_t t_us) {
+  // Espera dentro de uma IRQ: o relógio anda, o resto roda quando ela voltar
+  while (!in_irq) {
+    int i = alarm_earliest();
+    if (i < 0 || alarms[i].at > t_us)
+      break;
+    host_alarm_t a = alarms[i];
+    alarms[i].id = 0;
+    if (a.at > now_us)
+      now_us = a.at;
+
+    in_irq = true;
+    if (a.event) {
+      a.event(a.user_data);
+    } else {
+      // Como no SDK: > 0 reagenda a partir do disparo anterior, < 0 a partir de agora
+      int64_t again = a.callback(a.id, a.user_data);
+      if (again > 0)
+        alarm_insert(a.id, a.at + again, a.callback, NULL, a.user_data);
+      else if (again < 0)
+        alarm_insert(a.id, now_us - again, a.callback, NULL, a.user_data);
+    }
+    in_irq = false;
+    irq_dispatch();
+  }
+  if (t_us > now_us)
+    now_us = t_us;
+}
+
+void busy_wait_us(uint64_t delay_us) {
+  host_run_until(now_us + delay_us);
+}
+
+void sleep_us(uint64_t us) {
+  host_run_until(now_us + us);
+}
+
+void sleep_ms(uint32_t ms) {
+  host_run_until(now_us + ms * 1000ull);
+}
+
+static void dma_abort_requested(void);
+
+// Laço de espera ocupada: pula direto para o próximo evento
+void tight_loop_contents(void) {
+  if (dma_hw->abort)
+    dma_abort_requested();
+  uint64_t next = host_next_event_us();
+  host_run_until(next == UINT64_MAX ? now_us + 1 : next);
+}
+
+void __wfi(void) {
+  if (host_hooks.idle) {
+    host_hooks.idle();
+    return;
+  }
+  uint64_t next = host_next_event_us();
+  if (next == UINT64_MAX) {
+    fprintf(stderr, "host: __wfi() sem nenhum evento pendente\n");
+    exit(1);
+  }
+  host_run_until(next);
+}
+
+// --- IRQs ---
+
+#define HOST_IRQ_HANDLERS 4
+
+static irq_handler_t irq_handlers[NUM_IRQS][HOST_IRQ_HANDLERS];
+static uint32_t irq_enabled;
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+  for (uint i = 0; i < HOST_IRQ_HANDLERS; ++i) {
+    if (!irq_handlers[num][i]) {
+      irq_handlers[num][i] = handler;
+      return;
+    }
+  }
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+  irq_handlers[num][0] = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+  if (enabled)
+    irq_enabled |= 1u << num;
+  else
+    irq_enabled &= ~(1u << num);
+  irq_dispatch();
+}
+
+static void irq_raise(uint num) {
+  irq_pending |= 1u << num;
+  irq_dispatch();
+}
+
+static void irq_dispatch(void) {
+  while (!in_irq && (irq_pending & irq_enabled)) {
+    uint num = __builtin_ctz(irq_pending & irq_enabled);
+    irq_pending &= ~(1u << num);
+    in_irq = true;
+    for (uint i = 0; i < HOST_IRQ_HANDLERS && irq_handlers[num][i]; ++i)
+      irq_handlers[num][i]();
+    in_irq = false;
+  }
+}
+
+// --- GPIO ---
+
+#define HOST_GPIOS 30
+#define HOST_RAW_HANDLERS 4
+
+static bool gpio_level[HOST_GPIOS];
+static bool gpio_level_set[HOST_GPIOS]; // Sem nível definido, o pino lê alto (pull-up)
+static uint32_t gpio_irq_mask[HOST_GPIOS];
+static uint32_t gpio_irq_events[HOST_GPIOS];
+
+static struct {
+  uint32_t mask;
+  void (*handler)(void);
+} raw_handlers[HOST_RAW_HANDLERS];
+
+bool gpio_get(uint gpio) {
+  return gpio_level_set[gpio] ? gpio_level[gpio] : true;
+}
+
+void gpio_put(uint gpio, bool value) {
+  bool changed = gpio_get(gpio) != value;
+  gpio_level[gpio] = value;
+  gpio_level_set[gpio] = true;
+  if (changed && host_hooks.gpio_out)
+    host_hooks.gpio_out(gpio, value);
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) {
+  if (enabled)
+    gpio_irq_mask[gpio] |= event_mask;
+  else
+    gpio_irq_mask[gpio] &= ~event_mask;
+}
+
+static void gpio_bank_irq(void) {
+  for (uint i = 0; i < HOST_RAW_HANDLERS && raw_handlers[i].handler; ++i) {
+    for (uint gpio = 0; gpio < HOST_GPIOS; ++gpio) {
+      if ((raw_handlers[i].mask & (1u << gpio)) && gpio_irq_events[gpio]) {
+        raw_handlers[i].handler();
+        break;
+      }
+    }
+  }
+}
+
+void gpio_add_raw_irq_handler_masked(uint32_t gpio_mask, void (*handler)(void)) {
+  for (uint i = 0; i < HOST_RAW_HANDLERS; ++i) {
+    if (!raw_handlers[i].handler) {
+      raw_handlers[i].mask = gpio_mask;
+      raw_handlers[i].handler = handler;
+      break;
+    }
+  }
+  irq_handlers[IO_IRQ_BANK0][0] = gpio_bank_irq;
+  irq_enabled |= 1u << IO_IRQ_BANK0;
+}
+
+uint32_t gpio_get_irq_event_mask(uint gpio) {
+  return gpio_irq_events[gpio];
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) {
+  gpio_irq_events[gpio] &= ~event_mask;
+}
+
+void host_gpio_set(uint gpio, bool level) {
+  if (gpio_get(gpio) == level)
+    return;
+  gpio_level[gpio] = level;
+  gpio_level_set[gpio] = true;
+  uint32_t event = level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+  if (gpio_irq_mask[gpio] & event) {
+    gpio_irq_events[gpio] |= event;
+    irq_raise(IO_IRQ_BANK0);
+  }
+}
+
+static systick_hw_t systick_regs;
+systick_hw_t *const systick_hw = &systick_regs;
+static armv6m_scb_hw_t scb_regs;
+armv6m_scb_hw_t *const scb_hw = &scb_regs;
+
+// --- USB (stdio) ---
+
+#define HOST_STDIN_LEN 64
+
+static int stdin_buf[HOST_STDIN_LEN];
+static uint stdin_head, stdin_tail;
+
+int getchar_timeout_us(uint32_t timeout_us) {
+  if (stdin_head == stdin_tail)
+    return PICO_ERROR_TIMEOUT;
+  int c = stdin_buf[stdin_tail];
+  stdin_tail = (stdin_tail + 1) % HOST_STDIN_LEN;
+  return c;
+}
+
+void host_stdin_push(int c) {
+  uint next = (stdin_head + 1) % HOST_STDIN_LEN;
+  if (next != stdin_tail) {
+    stdin_buf[stdin_head] = c;
+    stdin_head = next;
+  }
+}
+
+// --- I2C ---
+
+static i2c_hw_t i2c_regs[2] = {
+  { .status = I2C_IC_STATUS_TFE_BITS },
+  { .status = I2C_IC_STATUS_TFE_BITS },
+};
+static i2c_inst_t i2c_insts[2] = { { &i2c_regs[0], 0 }, { &i2c_regs[1], 1 } };
+i2c_inst_t *const i2c0 = &i2c_insts[0];
+i2c_inst_t *const i2c1 = &i2c_insts[1];
+static uint i2c_baudrate[2] = { 100000, 100000 };
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+  i2c_baudrate[i2c->index] = baudrate;
+  return baudrate;
+}
+
+// 9 bits por byte (8 + ACK), mais o byte de endereço de cada transação
+static uint64_t i2c_bus_us(i2c_inst_t *i2c, size_t bytes) {
+  return (uint64_t)bytes * 9 * 1000000 / i2c_baudrate[i2c->index];
+}
+
+static void i2c_transaction(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+  host_bus.i2c_bytes += len;
+  if (!nostop)
+    host_bus.i2c_transactions++;
+  if (host_hooks.i2c_write)
+    host_hooks.i2c_write(i2c->index, addr, src, len);
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+  i2c_transaction(i2c, addr, src, len, nostop);
+  busy_wait_us(i2c_bus_us(i2c, len + 1));
+  if (host_hooks.i2c_done)
+    host_hooks.i2c_done(i2c->index);
+  return (int)len;
+}
+
+// --- PIO ---
+
+pio_hw_t host_pio[2];
+
+int pio_claim_unused_sm(PIO pio, bool required) {
+  return 0;
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program) {
+  return 0;
+}
+
+static void pio_write(PIO pio, uint sm, const uint32_t *words, uint count) {
+  for (uint i = 0; i < count; ++i)
+    pio->txf[sm] = words[i];
+  host_bus.pio_words += count;
+  if (host_hooks.pio_write)
+    host_hooks.pio_write(sm, words, count);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) {
+  pio_write(pio, sm, &data, 1);
+}
+
+// --- Flash ---
+
+uint8_t host_flash[PICO_FLASH_SIZE_BYTES];
+
+// Flash nova, toda apagada; o simulador pode carregar uma imagem por cima
+__attribute__((constructor)) static void flash_reset(void) {
+  memset(host_flash, 0xFF, sizeof(host_flash));
+}
+
+static void flash_check(uint32_t offset, size_t count, uint32_t align) {
+  if (offset % align || count % align || offset + count > PICO_FLASH_SIZE_BYTES) {
+    fprintf(stderr, "flash: acesso fora do alinhamento (0x%x, %zu)\n", (unsigned)offset, count);
+    abort();
+  }
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+  flash_check(flash_offs, count, FLASH_SECTOR_SIZE);
+  memset(host_flash + flash_offs, 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count) {
+  flash_check(flash_offs, count, FLASH_PAGE_SIZE);
+  for (size_t i = 0; i < count; ++i)
+    host_flash[flash_offs + i] &= data[i];
+}
+
+// --- Clocks ---
+
+// Valor de reset: todos os clocks continuam no sono. Não há efeito no host.
+static clocks_hw_t clocks_regs = { ~0u, ~0u };
+clocks_hw_t *const clocks_hw = &clocks_regs;
+
+// --- PWM ---
+
+static pwm_hw_t pwm_regs;
+pwm_hw_t *const pwm_hw = &pwm_regs;
+
+void pwm_init(uint slice_num, pwm_config *c, bool start) {
+  pwm_regs.slice[slice_num].div = c->div;
+  pwm_regs.slice[slice_num].top = c->top;
+  pwm_regs.slice[slice_num].csr = start;
+}
+
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract) {
+  pwm_regs.slice[slice_num].div = (uint32_t)integer << 4 | fract;
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap) {
+  pwm_regs.slice[slice_num].top = wrap;
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level) {
+  volatile uint32_t *cc = &pwm_regs.slice[slice_num].cc;
+  uint shift = chan ? 16 : 0;
+  uint16_t old = (uint16_t)(*cc >> shift);
+  *cc = (*cc & ~(0xFFFFu << shift)) | (uint32_t)level << shift;
+  if (level != old && host_hooks.pwm_level)
+    host_hooks.pwm_level(slice_num * 2 + chan, level);
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level) {
+  pwm_set_chan_level(pwm_gpio_to_slice_num(gpio), pwm_gpio_to_channel(gpio), level);
+}
+
+// --- ADC ---
+
+static adc_hw_t adc_regs;
+adc_hw_t *const adc_hw = &adc_regs;
+static uint16_t adc_value[5] = { 2048, 2048, 2048, 2048, 2048 };
+static uint adc_input, adc_rr_mask;
+static bool adc_running;
+
+static void adc_fill_rings(void);
+
+void adc_select_input(uint input) {
+  adc_input = input;
+}
+
+void adc_set_round_robin(uint input_mask) {
+  adc_rr_mask = input_mask;
+}
+
+void adc_run(bool run) {
+  adc_running = run;
+  adc_fill_rings();
+}
+
+uint16_t adc_read(void) {
+  return adc_value[adc_input];
+}
+
+void host_adc_set(uint input, uint16_t value) {
+  adc_value[input] = value;
+  adc_fill_rings();
+}
+
+// --- DMA ---
+
+typedef struct {
+  bool claimed;
+  bool paced_forever;   // Lendo o FIFO do ADC: nunca termina
+  dma_channel_config config;
+  volatile void *write_addr;
+  const volatile void *read_addr;
+  uint32_t count;
+  alarm_id_t done;      // Fim da transferência em andamento
+  bool irq_enabled[2];
+} host_dma_t;
+
+static host_dma_t dma_channels[NUM_DMA_CHANNELS];
+static dma_hw_t dma_regs;
+dma_hw_t *const dma_hw = &dma_regs;
+static uint32_t dma_timer_fraction[4][2];
+static uint dma_timers_claimed;
+
+int dma_claim_unused_channel(bool required) {
+  for (uint c = 0; c < NUM_DMA_CHANNELS; ++c) {
+    if (!dma_channels[c].claimed) {
+      dma_channels[c].claimed = true;
+      return (int)c;
+    }
+  }
+  return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+  return (dma_channel_config){ .size = DMA_SIZE_32, .dreq = 0x3f, .chain_to = channel };
+}
+
+int dma_claim_unused_timer(bool required) {
+  return dma_timers_claimed < 4 ? (int)dma_timers_claimed++ : -1;
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator) {
+  dma_timer_fraction[timer][0] = numerator;
+  dma_timer_fraction[timer][1] = denominator;
+}
+
+void dma_irqn_set_channel_enabled(uint irq_index, uint channel, bool enabled) {
+  dma_channels[channel].irq_enabled[irq_index] = enabled;
+}
+
+// Anéis de DMA lendo o FIFO do ADC recebem as entradas na ordem do round-robin
+static void adc_fill_rings(void) {
+  if (!adc_running)
+    return;
+  for (uint c = 0; c < NUM_DMA_CHANNELS; ++c) {
+    host_dma_t *dma = &dma_channels[c];
+    if (!dma->paced_forever)
+      continue;
+    uint16_t *ring = (uint16_t *)dma->write_addr;
+    uint32_t len = dma->config.ring_bits ? (1u << dma->config.ring_bits) / sizeof(uint16_t) : dma->count;
+    uint input = adc_input;
+    for (uint32_t i = 0; i < len; ++i) {
+      ring[i] = adc_value[input];
+      if (adc_rr_mask) {
+        do
+          input = (input + 1) % 5;
+        while (!(adc_rr_mask & (1u << input)));
+      }
+    }
+  }
+}
+
+static void dma_start(uint channel);
+
+// Palavras de IC_DATA_CMD viram transações I2C, separadas pelo bit STOP
+static uint64_t dma_to_i2c(i2c_inst_t *i2c, const uint16_t *words, uint32_t count) {
+  static uint8_t bytes[2048]; // Cabe um quadro inteiro do display em uma transação
+  size_t len = 0, transactions = 0;
+  i2c->hw->status = I2C_IC_STATUS_MST_ACTIVITY_BITS;
+  for (uint32_t i = 0; i < count; ++i) {
+    bytes[len++] = (uint8_t)words[i];
+    bool stop = words[i] & I2C_IC_DATA_CMD_STOP_BITS;
+    if (stop || len == sizeof(bytes)) {
+      i2c_transaction(i2c, (uint8_t)i2c->hw->tar, bytes, len, !stop);
+      len = 0;
+      transactions += stop;
+    }
+  }
+  if (len)
+    i2c_transaction(i2c, (uint8_t)i2c->hw->tar, bytes, len, true);
+  return i2c_bus_us(i2c, count + transactions);
+}
+
+static void dma_done(void *arg) {
+  uint channel = (host_dma_t *)arg - dma_channels;
+  host_dma_t *dma = arg;
+  dma->done = 0;
+
+  for (uint i = 0; i < 2; ++i) {
+    i2c_inst_t *i2c = &i2c_insts[i];
+    if (dma->write_addr == &i2c->hw->data_cmd) {
+      i2c->hw->status = I2C_IC_STATUS_TFE_BITS;
+      i2c->hw->raw_intr_stat |= I2C_IC_RAW_INTR_STAT_STOP_DET_BITS;
+      if (host_hooks.i2c_done)
+        host_hooks.i2c_done(i);
+      if (i2c->hw->intr_mask & I2C_IC_INTR_MASK_M_STOP_DET_BITS)
+        irq_raise(I2C0_IRQ + i);
+    }
+  }
+  if (dma->config.chain_to != channel)
+    dma_start(dma->config.chain_to);
+  if (dma->irq_enabled[0]) {
+    dma_regs.ints0 |= 1u << channel;
+    irq_raise(DMA_IRQ_0);
+  }
+  if (dma->irq_enabled[1]) {
+    dma_regs.ints1 |= 1u << channel;
+    irq_raise(DMA_IRQ_1);
+  }
+}
+
+// Entrega os dados ao destino e agenda o fim pelo tempo que o destino leva
+static void dma_start(uint channel) {
+  host_dma_t *dma = &dma_channels[channel];
+  if (!(dma_regs.ch[channel].al1_ctrl & DMA_CH0_CTRL_TRIG_EN_BITS))
+    return;
+  if (dma->done)
+    cancel_alarm(dma->done);
+  dma->done = 0;
+
+  if (dma->read_addr == &adc_hw->fifo) {
+    dma->paced_forever = true;
+    adc_fill_rings();
+    return;
+  }
+
+  uint64_t us = 0;
+  uint dreq = dma->config.dreq;
+  for (uint i = 0; i < 2; ++i) {
+    if (dma->write_addr == &i2c_insts[i].hw->data_cmd)
+      us = dma_to_i2c(&i2c_insts[i], (const uint16_t *)dma->read_addr, dma->count);
+  }
+  for (uint p = 0; p < 2; ++p) {
+    for (uint sm = 0; sm < 4; ++sm) {
+      if (dma->write_addr == &host_pio[p].txf[sm]) {
+        pio_write(&host_pio[p], sm, (const uint32_t *)dma->read_addr, dma->count);
+        us = dma->count * 30; // 24 bits a 800 kHz por palavra
+      }
+    }
+  }
+  if (dreq >= dma_get_timer_dreq(0) && dreq <= dma_get_timer_dreq(3)) {
+    // Ritmo do timer: numerador/denominador do clk_sys por transferência
+    const uint32_t *f = dma_timer_fraction[dreq - dma_get_timer_dreq(0)];
+    if (f[0])
+      us = (uint64_t)dma->count * f[1] * 1000000 / ((uint64_t)HOST_CLK_SYS_HZ * f[0]);
+  }
+  dma->done = host_schedule(us, dma_done, dma);
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+  host_dma_t *dma = &dma_channels[channel];
+  dma->config = *config;
+  dma->write_addr = write_addr;
+  dma->read_addr = read_addr;
+  dma->count = transfer_count;
+  dma_regs.ch[channel].al1_ctrl |= DMA_CH0_CTRL_TRIG_EN_BITS;
+  if (trigger)
+    dma_start(channel);
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+  dma_channels[channel].read_addr = read_addr;
+  dma_channels[channel].count = transfer_count;
+  dma_start(channel);
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger) {
+  dma_channels[channel].read_addr = read_addr;
+  if (trigger)
+    dma_start(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger) {
+  dma_channels[channel].count = trans_count;
+  if (trigger)
+    dma_start(channel);
+}
+
+void dma_channel_start(uint channel) {
+  dma_start(channel);
+}
+
+bool dma_channel_is_busy(uint channel) {
+  return dma_channels[channel].done != 0 || dma_channels[channel].paced_forever;
+}
+
+void dma_channel_abort(uint channel) {
+  host_dma_t *dma = &dma_channels[channel];
+  if (dma->done)
+    cancel_alarm(dma->done);
+  dma->done = 0;
+  dma->paced_forever = false;
+}
+
+// Escrita em dma_hw->abort: os canais param na hora
+static void dma_abort_requested(void) {
+  for (uint c = 0; c < NUM_DMA_CHANNELS; ++c) {
+    if (dma_regs.abort & (1u << c))
+      dma_channel_abort(c);
+  }
+  dma_regs.abort = 0;
+}
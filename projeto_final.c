@@ -3,11 +3,25 @@
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 #include "hardware/pwm.h"
-#include "hardware/adc.h"
 #include "hardware/timer.h"
 #include "src/ssd1306.h"
 #include "src/buzzer.h"
-#include "projeto_final.pio.h"
+#include "src/screen.h"
+#include "src/sched.h"
+#include "src/input.h"
+#include "src/output.h"
+#include "src/ws2812.h"
+#include "src/matrix.h"
+#include "src/anim.h"
+#include "src/joystick.h"
+#include "src/cursor.h"
+#include "src/hist.h"
+#include "src/trace.h"
+#include "src/perf.h"
+#include "src/console.h"
+#include "src/clips.h"
+#include "src/power.h"
+#include "src/kvlog.h"
 
 // Definições de constantes
 #define I2C_PORT i2c1
@@ -19,63 +33,261 @@
 #define BUTTON_B_PIN 6
 #define LED_PIN 13  // Pino do LED
 #define PINO_MATRIZ 7
-#define DEBOUNCE_TIME_MS 200 // Tempo de debouncing em milissegundos
 #define TEMPO_BASE 5000000 // 5 segundo por clique no botão A
 
-// Pinagem do Joystick
-#define JOYSTICK_PINO_X 27
-#define JOYSTICK_PINO_Y 26
+// Pinagem do Joystick (eixos X e Y nos pinos 27 e 26, lidos pelo módulo joystick)
 #define JOYSTICK_BOTAO 22
-#define RESOLUCAO_ADC 4096
-#define CENTRO_ADC 2048
-#define LIMITE_JOYSTICK 100 // Limite para considerar movimento do joystick
+#define LIMITE_JOYSTICK 100 // Zona morta em torno do centro calibrado
+
+#define TEMPO_META_US 3000000     // "Meta 10ac" fica 3 s na tela
+#define TEMPO_LIMITE_US 30000000  // Duração do teste de reflexo
+#ifndef META_ACERTOS
+#define META_ACERTOS 10           // O simulador do host compila com 0: o roteiro não mira no alvo
+#endif
+#define PERIODO_QUADRO_US 20000   // Redesenho da matriz no teste de reflexo (50 Hz)
+#define PERIODO_ROLAGEM_US 50000  // Passo da rolagem das instruções (20 linhas de pixels/s)
+#define TEMPO_RESULTADO_US 4000000 // Estatísticas de reação na tela ao fim da sessão
+#define PERIODO_JOYSTICK_US 100000
+#define PAUSA_BEEP_US 1100000      // Beep de 500 ms + pausas, como no fluxo original
+#define TEMPO_TELA_ACESA_US 10000000  // Tela da contagem acesa no início e após um botão
+#define TEMPO_ESPIADA_US 3000000      // Tela fraca mostrando o tempo restante
+#define PERIODO_ESPIADA_US 60000000   // Espiada a cada minuto com a tela apagada (0 = nunca)
+
+// Eventos tratados pela máquina de estados
+enum {
+    EV_BOTAO_A = 1,    // Botão A (arg = input_action_t)
+    EV_BOTAO_B,        // Botão B
+    EV_BOTAO_JOYSTICK, // Botão do joystick
+    EV_TEMPO_ESTADO,   // Temporizador do estado atual expirou
+    EV_TICK,           // Tick periódico do estado atual
+    EV_LED_FIM,        // Fim da piscada do LED
+    EV_ANIMACAO,       // Cue ou fim (arg = ANIM_DONE) da animação da matriz
+    EV_QUADRO,         // Redesenho da matriz no teste de reflexo, passo da rolagem nos alongamentos
+    EV_TELA,           // Fim da janela de tela acesa na contagem
+};
+
+// Chaves salvas na flash (src/kvlog.h)
+enum {
+    CHAVE_TEMPO,      // tempo_espera da última configuração
+    CHAVE_HISTORICO,  // historico_t
+};
+
+// Histórico das sessões, mantido entre reinícios
+typedef struct {
+    uint32_t ciclos;            // Ciclos completos, até o fim dos alongamentos
+    uint32_t testes_reflexo;
+    uint32_t melhor_reacao_us;  // Menor tempo de reação já medido (0 = nenhum)
+    uint32_t ultima_media_us;   // Média de reação do último teste
+} historico_t;
+
+// Estados do fluxo: config → contagem → alarme → reflexo → descanso → alongamento
+typedef enum {
+    ESTADO_INICIO,
+    ESTADO_CONFIG,
+    ESTADO_CONTAGEM,
+    ESTADO_ALERTA,
+    ESTADO_ALARME_DESLIGADO,
+    ESTADO_REFLEXO_META,
+    ESTADO_REFLEXO_JOGO,
+    ESTADO_REFLEXO_SUCESSO,
+    ESTADO_REFLEXO_FALHA,
+    ESTADO_REFLEXO_RESULTADO,
+    ESTADO_ANIMACAO_FINAL,
+    ESTADO_DESCANSO,
+    ESTADO_PAUSA_CONCLUIDA,
+    ESTADO_ALONGAMENTO,
+    ESTADO_ALONGAMENTO_CONFIRMA,
+    ESTADO_ALONGAMENTO_PISCAR,
+    ESTADO_ALONGAMENTOS_FIM,
+} estado_t;
 
 // Variáveis globais
-ssd1306_t display;
-volatile bool buzzer_active = false;
-volatile uint64_t start_time;
-volatile bool button_b_pressed = false;
-volatile int tempo_espera = 0; // Tempo configurado pelo botão A
-volatile bool tempo_definido = false;
-
-static uint8_t matriz[25][3];  // Matriz para armazenar o estado de cada LED (R, G, B)
-static PIO pio_matriz;         // Controlador PIO usado para a matriz de LEDs
-static uint maquina;           // Máquina de estado PIO usada para controlar a matriz
+ssd1306_t display; // Só é acessado pelo núcleo de saída (src/output.c)
+static int tempo_espera = 0; // Tempo configurado pelo botão A
+static estado_t estado = ESTADO_INICIO;
+static sched_timer_t timer_estado; // Duração do estado atual
+static sched_timer_t timer_tick;   // Tick periódico do estado atual
+static sched_timer_t timer_led;
+static sched_timer_t timer_quadro; // Redesenho da matriz, separado do passo do jogo
+static sched_timer_t timer_tela;   // Apaga a tela da contagem
+static uint64_t fim_contagem;      // Instante do alarme
+
+static uint32_t matriz[25];    // Quadro composto (ws2812_rgb) enviado à saída
+
+// Camadas da matriz, somadas na composição
+enum {
+    CAMADA_FUNDO,   // Preenchimentos e animações
+    CAMADA_ALVO,    // Ponto vermelho do teste de reflexo
+    CAMADA_CURSOR,  // Ponto do jogador
+};
 static volatile int numero_atual = 0;
 
-// Variáveis para debouncing
-static uint64_t last_button_a_time = 0;
-static uint64_t last_button_b_time = 0;
+// Telas do display: a parte fixa é desenhada uma vez e mantida em cache
+static const screen_label_t rotulos_inicio[] = {{"Pressione A", 10, 10}, {"config alarme", 10, 30}};
+static const screen_label_t rotulos_config[] = {{"Config Alarme", 10, 10}};
+static const screen_field_t campos_config[] = {{"Tempo: %d s", 20, 30}};
+static const screen_field_t campos_acertos[] = {{"Acertos: %d", 20, 20}};
+static const screen_field_t campos_reacao[] = {
+    {"Min: %d ms", 10, 5}, {"Media: %d ms", 10, 16}, {"p50: %d ms", 10, 27},
+    {"p95: %d ms", 10, 38}, {"Max: %d ms", 10, 49},
+};
+static const screen_label_t rotulos_definido[] = {{"Definido", 40, 20}, {"Aguarde", 20, 40}};
+static const screen_label_t rotulos_restante[] = {{"Proxima pausa", 10, 20}};
+static const screen_field_t campos_restante_min[] = {{"em %d min", 30, 40}};
+static const screen_field_t campos_restante_s[] = {{"em %d s", 30, 40}};
+static const screen_label_t rotulos_alarme_desligado[] = {{"Alarme", 40, 20}, {"desligado", 20, 35}, {"Aguarde", 30, 50}};
+static const screen_label_t rotulos_pausa[] = {{"Pausa!", 40, 20}, {"Pressione B", 20, 40}};
+static const screen_label_t rotulos_confirma_joystick[] = {{"Pressione o", 20, 20}, {"joystick", 30, 35}};
+static const screen_label_t rotulos_alongamentos_fim[] = {{"Alongamentos", 20, 20}, {"finalizados!", 20, 35}};
+static const screen_field_t campos_descanso[] = {{"Feche os olhos: %d", 7, 25}};
+static const screen_label_t rotulos_pausa_concluida[] = {{"Pausa", 15, 20}, {"Concluida", 10, 35}};
+static const screen_label_t rotulos_meta[] = {{"Meta 10ac", 10, 20}, {"Tempo 30s", 10, 35}};
+static const screen_label_t rotulos_ache_ponto[] = {{"Ache o", 40, 20}, {"ponto vermelho", 10, 35}};
+static const screen_label_t rotulos_parabens[] = {{"Parabens!", 30, 20}, {"Meta alcancada", 10, 35}};
+static const screen_label_t rotulos_tempo_esgotado[] = {{"Tempo esgotado!", 10, 20}, {"Pressione B para", 10, 35}, {"tentar novamente", 10, 50}};
+
+static screen_t tela_inicio = SCREEN_STATIC(rotulos_inicio);
+static screen_t tela_config = SCREEN_WITH_FIELDS(rotulos_config, campos_config);
+static screen_t tela_acertos = SCREEN_FIELDS(campos_acertos);
+static screen_t tela_reacao = SCREEN_FIELDS(campos_reacao);
+static screen_t tela_definido = SCREEN_STATIC(rotulos_definido);
+static screen_t tela_restante_min = SCREEN_WITH_FIELDS(rotulos_restante, campos_restante_min);
+static screen_t tela_restante_s = SCREEN_WITH_FIELDS(rotulos_restante, campos_restante_s);
+static screen_t tela_alarme_desligado = SCREEN_STATIC(rotulos_alarme_desligado);
+static screen_t tela_pausa = SCREEN_STATIC(rotulos_pausa);
+static screen_t tela_confirma_joystick = SCREEN_STATIC(rotulos_confirma_joystick);
+static screen_t tela_alongamentos_fim = SCREEN_STATIC(rotulos_alongamentos_fim);
+static screen_t tela_descanso = SCREEN_FIELDS(campos_descanso);
+static screen_t tela_pausa_concluida = SCREEN_STATIC(rotulos_pausa_concluida);
+static screen_t tela_meta = SCREEN_STATIC(rotulos_meta);
+static screen_t tela_ache_ponto = SCREEN_STATIC(rotulos_ache_ponto);
+static screen_t tela_parabens = SCREEN_STATIC(rotulos_parabens);
+static screen_t tela_tempo_esgotado = SCREEN_STATIC(rotulos_tempo_esgotado);
+
+// Instruções de cada alongamento, rolando em laço pela start line do display
+// (src/scroller.h), com a contagem regressiva no %d. Cada texto tem o seu
+// número de linhas; o anel de 8 páginas não depende dele.
+typedef struct {
+    const char *const *linhas;
+    uint8_t quantidade;
+} texto_alongamento_t;
+
+#define TEXTO_ALONGAMENTO(linhas) { (linhas), SCREEN_COUNT(linhas) }
+
+static const char *const texto_bracos[] = {"Se alongue", "", "Estique os", "bracos para", "cima e segure", "", "Tempo: %d"};
+static const char *const texto_ombros[] = {"Gire ombros", "", "Gire os ombros", "para tras,", "bem devagar", "", "Tempo: %d"};
+static const char *const texto_pescoco[] = {"Alongue pescoco", "", "Incline a", "cabeca para", "cada lado e", "segure um", "pouco", "", "Tempo: %d"};
+static const char *const texto_olhos[] = {"Pisque olhos", "", "Pisque varias", "vezes e olhe", "para longe", "", "Tempo: %d"};
+
+static const texto_alongamento_t textos_alongamento[4] = {
+    TEXTO_ALONGAMENTO(texto_bracos),
+    TEXTO_ALONGAMENTO(texto_ombros),
+    TEXTO_ALONGAMENTO(texto_pescoco),
+    TEXTO_ALONGAMENTO(texto_olhos),
+};
+
+// Animações da matriz (quadros-chave em coordenadas lógicas)
+// Linhas amarelas acendendo de cima para baixo, com um beep a cada linha
+static const anim_key_t quadros_linhas[] = {
+    {ANIM_ROW(4), 128, 128, 0, ANIM_CUE, 1100},
+    {ANIM_ROW(4) | ANIM_ROW(3), 128, 128, 0, ANIM_CUE, 1100},
+    {ANIM_ROW(4) | ANIM_ROW(3) | ANIM_ROW(2), 128, 128, 0, ANIM_CUE, 1100},
+    {ANIM_ALL & ~(ANIM_ROW(0)), 128, 128, 0, ANIM_CUE, 1100},
+    {ANIM_ALL, 128, 128, 0, ANIM_CUE, 1100},
+};
+// Pisca em verde 3 vezes e fica apagada um pouco antes do próximo alongamento
+static const anim_key_t quadros_piscar[] = {
+    {ANIM_ALL, 0, 128, 0, 0, 200}, {0, 0, 0, 0, 0, 200},
+    {ANIM_ALL, 0, 128, 0, 0, 200}, {0, 0, 0, 0, 0, 200},
+    {ANIM_ALL, 0, 128, 0, 0, 200}, {0, 0, 0, 0, 0, 700},
+};
+// Ponto azul girando pela borda enquanto espera o joystick
+static const anim_key_t quadros_giro[] = {
+    {ANIM_PIXEL(0, 4), 0, 0, 128, 0, 80}, {ANIM_PIXEL(1, 4), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(2, 4), 0, 0, 128, 0, 80}, {ANIM_PIXEL(3, 4), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(4, 4), 0, 0, 128, 0, 80}, {ANIM_PIXEL(4, 3), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(4, 2), 0, 0, 128, 0, 80}, {ANIM_PIXEL(4, 1), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(4, 0), 0, 0, 128, 0, 80}, {ANIM_PIXEL(3, 0), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(2, 0), 0, 0, 128, 0, 80}, {ANIM_PIXEL(1, 0), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(0, 0), 0, 0, 128, 0, 80}, {ANIM_PIXEL(0, 1), 0, 0, 128, 0, 80},
+    {ANIM_PIXEL(0, 2), 0, 0, 128, 0, 80}, {ANIM_PIXEL(0, 3), 0, 0, 128, 0, 80},
+};
+// Verde que se apaga aos poucos ao fim da pausa
+static const anim_key_t quadros_esmaecer[] = {
+    {ANIM_ALL, 0, 128, 0, ANIM_TWEEN, 1500},
+    {ANIM_ALL, 0, 0, 0, 0, 0},
+};
+
+static const anim_t anim_linhas = ANIM_ONCE(quadros_linhas);
+static const anim_t anim_piscar = ANIM_ONCE(quadros_piscar);
+static const anim_t anim_giro = ANIM_LOOP(quadros_giro);
+static const anim_t anim_esmaecer = ANIM_ONCE(quadros_esmaecer);
+
+// Sons do buzzer (frequência em Hz, 0 = pausa; duração em ms)
+static const buzzer_note_t notas_alarme[] = {{2000, 250}, {0, 250}};
+static const buzzer_note_t notas_beep[] = {{2000, 500}};
+static const buzzer_note_t notas_beep_curto[] = {{2500, 200}};
+
+static const buzzer_melody_t melodia_alarme = BUZZER_MELODY(notas_alarme, 30); // 15 s ou até B
+static const buzzer_melody_t melodia_beep = BUZZER_MELODY(notas_beep, 1);
+static const buzzer_melody_t melodia_beep_curto = BUZZER_MELODY(notas_beep_curto, 1);
+
+// Curva de aceleração do cursor: desvio do joystick -> centésimos de célula/s.
+// Perto do centro o cursor anda devagar para acertos finos.
+static const cursor_curve_point_t pontos_curva[] = {
+    {LIMITE_JOYSTICK, 50}, {600, 300}, {1400, 800}, {2000, 1500},
+};
+static const cursor_curve_t curva_cursor = CURSOR_CURVE(pontos_curva);
+
 
 // Variáveis para o teste de reflexo
 static int posicao_alvo_x = 2; // Posição inicial do ponto alvo (centro da matriz)
 static int posicao_alvo_y = 2;
-static int posicao_usuario_x = 2; // Posição inicial do ponto do usuário (centro da matriz)
+static int posicao_usuario_x = 2; // Célula do cursor (centro da matriz no início)
 static int posicao_usuario_y = 2;
-static uint64_t tempo_resposta = 0; // Tempo de resposta do usuário
-static bool teste_em_andamento = false;
+static cursor_t cursor;            // Posição fina do cursor, em frações de célula
+static uint64_t tempo_jogo;        // Instante já simulado pelos passos fixos
+static bool matriz_suja;           // Cursor ou alvo mudaram desde o último quadro
+static uint32_t tempo_resposta = 0; // Último tempo de reação (µs), do alvo aceso ao acerto
+// Instante em que cada alvo travou nos LEDs (0 = ainda não). O carimbo do
+// alvo anterior ainda pode estar a caminho (quadro em envio no núcleo de
+// saída) quando o próximo surge: cada alvo usa a sua posição do anel, e o
+// atraso só cairia na posição de volta depois de ALVO_CARIMBOS alvos.
+#define ALVO_CARIMBOS 4
+static volatile uint32_t alvo_aceso_us[ALVO_CARIMBOS];
+static uint8_t alvo_carimbo;        // Posição do alvo atual em alvo_aceso_us
+static bool alvo_novo;              // O próximo quadro enviado marca o instante do alvo
+static hist_t reacoes;              // Tempos de reação da sessão
+static int acertos = 0; // Contador de acertos
+static historico_t historico;
+
+// Contadores das etapas com várias repetições
+static int tempo_restante = 0; // Segundos restantes da contagem na tela
+static int exercicio = 0;      // Alongamento atual
 
 // Protótipos das funções
 void exibir_acertos(int acertos);
 void piscar_led();
-bool debounce_button_a();
-bool debounce_button_b();
-void button_a_callback();
-void button_b_callback(uint gpio, uint32_t events);
-void emitir_alerta();
-void inicializar_matriz(uint pino);
+bool pressionou(const sched_event_t *ev, uint16_t botao);
+void iniciar_beep(const buzzer_melody_t *melodia);
+void parar_beep();
+void mostrar_tela(screen_t *tela, const int *valores);
+void entrar_estado(estado_t novo);
+void tratar_evento(const sched_event_t *ev);
+void inicializar_saidas();
 void limpar_matriz();
-void atualizar_linha(int linha);
+void preencher_matriz(uint8_t r, uint8_t g, uint8_t b);
 void atualizar_matriz();
-void desenhar_ponto(int x, int y, int cor, int intensidade);
-void alongamento_guiado();
-void descansar_olhos();
-void animacao_piscar();
-void animacao_final();
-void ler_joystick(uint16_t *x, uint16_t *y);
+void desenhar_ponto(uint8_t camada, int x, int y, uint8_t r, uint8_t g, uint8_t b);
 void mover_ponto_alvo();
-void mapear_joystick_para_matriz(uint16_t x_raw, uint16_t y_raw, int *movimento_x, int *movimento_y);
-void teste_reflexo();
+void desenhar_alvo();
+void relatorio_reacoes();
+void mapear_joystick_para_matriz(int *movimento_x, int *movimento_y);
+void passo_reflexo(uint64_t agora);
+void mostrar_restante();
+void acender_tela(power_state_t modo, uint32_t duracao_us);
+bool gravacao_liberada(bool apagar);
+void relatorio_historico();
 
 // Função principal
 int main() {
@@ -86,413 +298,593 @@ int main() {
     gpio_pull_up(SDA_PIN);
     gpio_pull_up(SCL_PIN);
 
-    // Inicializa o ADC para o joystick
-    adc_init();
-    adc_gpio_init(JOYSTICK_PINO_X);
-    adc_gpio_init(JOYSTICK_PINO_Y);
-
-    inicializar_matriz(PINO_MATRIZ);
-    limpar_matriz();
-
-    ssd1306_init(&display, 128, 64, false, OLED_ADDR, I2C_PORT);
-    ssd1306_config(&display);
-    ssd1306_fill(&display, false);
-    ssd1306_send_data(&display);
-
-    gpio_init(BUTTON_A_PIN);
-    gpio_set_dir(BUTTON_A_PIN, GPIO_IN);
-    gpio_pull_up(BUTTON_A_PIN);
-
-    gpio_init(BUTTON_B_PIN);
-    gpio_set_dir(BUTTON_B_PIN, GPIO_IN);
-    gpio_pull_up(BUTTON_B_PIN);
-    gpio_set_irq_enabled_with_callback(BUTTON_B_PIN, GPIO_IRQ_EDGE_FALL, true, &button_b_callback);
-
-    pwm_init_buzzer(BUZZER_PIN);
+    // ADC em round-robin com DMA; o centro é calibrado com o joystick solto
+    joystick_init();
+    joystick_calibrate();
+    joystick_set_deadzone(LIMITE_JOYSTICK);
 
     // Inicializar GPIO 13 para o LED
     gpio_init(LED_PIN);
     gpio_set_dir(LED_PIN, GPIO_OUT);
     gpio_put(LED_PIN, 0);  // Garantir que o LED esteja apagado inicialmente
 
-    ssd1306_fill(&display, false);
-    ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-    ssd1306_draw_string(&display, "Pressione A", 10, 10);
-    ssd1306_draw_string(&display, "config alarme", 10, 30);
-    ssd1306_send_data(&display);
-
-    while (gpio_get(BUTTON_A_PIN) || !gpio_get(BUTTON_A_PIN)) {
-        if (!gpio_get(BUTTON_A_PIN)) {  // Se o botão for pressionado (nível baixo)
-            while (!gpio_get(BUTTON_A_PIN)) {  // Espera ser solto
-                sleep_ms(50);
-            }
-            break;  // Sai do loop quando o botão for pressionado e depois solto
-        }
-        sleep_ms(50);
-    }
-        
-    // Loop principal
-    while (true) {
-        // Modo de configuração do tempo
-        if (!tempo_definido) {
-            // Detecta o clique do botão A
-            if (gpio_get(BUTTON_A_PIN) == 0) { // Verifica se o botão A está pressionado (GND)
-                button_a_callback();
-            }
-
-            // Atualiza o display com o tempo selecionado
-            ssd1306_fill(&display, false);
-            ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-            char msg[20];
-            snprintf(msg, sizeof(msg), "Tempo: %d s", tempo_espera / 1000000);
-            ssd1306_draw_string(&display, "Config Alarme", 10, 10);
-            ssd1306_draw_string(&display, msg, 20, 30);
-            ssd1306_send_data(&display);
-
-            // Se o botão B for pressionado, confirma o tempo e inicia o contador
-            if (button_b_pressed) {
-                tempo_definido = true;
-                start_time = time_us_64();
-                button_b_pressed = false;
-
-                // Exibe a mensagem "Contador iniciado!"
-                ssd1306_fill(&display, false);
-                ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-                ssd1306_draw_string(&display, "Contador", 40, 20);
-                ssd1306_draw_string(&display, "iniciado!", 30, 40);
-                ssd1306_send_data(&display);
-                sleep_ms(2000); // Mostra a mensagem por 2 segundos
-            }
-        }
-        // Modo de contagem do tempo
-        else {
-            if (time_us_64() - start_time >= tempo_espera) {
-                emitir_alerta(); // Toca o alarme
-                teste_reflexo(); // Inicia o teste de reflexo
-                tempo_definido = false; // Reseta o tempo para permitir nova configuração
-                tempo_espera = 0; // Reseta o tempo de espera
-            }
-        }
-
-        sleep_ms(100); // Pequeno delay para evitar uso excessivo da CPU
-    }
+    sched_init();
+    sched_add_handler(tratar_evento);
+    console_init();
+    perf_init();  // 'p' na USB: tabela de tempos das funções mais quentes
+    trace_init(); // Só com TRACE_ENABLED: despeja o rastreamento ao receber 't' na USB
+    anim_init(CAMADA_FUNDO, EV_ANIMACAO, atualizar_matriz);
+    cursor_init(&cursor, &curva_cursor, MATRIX_WIDTH, MATRIX_HEIGHT);
+
+    // Display, matriz e buzzer passam a ser do núcleo 1 (ou do 0, sem multicore)
+    output_init(&display, inicializar_saidas);
+    power_init(); // 'e' na USB: tempo em cada estado de energia
+
+    // Os botões só postam eventos; todo o fluxo roda na máquina de estados
+    input_init();
+    input_add_button(BUTTON_A_PIN, EV_BOTAO_A);
+    input_add_button(BUTTON_B_PIN, EV_BOTAO_B);
+    input_add_button(JOYSTICK_BOTAO, EV_BOTAO_JOYSTICK);
+    input_start();
+
+    // Com um tempo salvo na flash, o boot vai direto para a contagem
+    // (segurar A na contagem volta à configuração)
+    kvlog_init(gravacao_liberada);
+    kvlog_get(CHAVE_HISTORICO, &historico, sizeof(historico));
+    console_add_command('h', relatorio_historico); // 'h' na USB: histórico e flash
+    if (kvlog_get(CHAVE_TEMPO, &tempo_espera, sizeof(tempo_espera)) && tempo_espera > 0)
+        entrar_estado(ESTADO_CONTAGEM);
+    else
+        entrar_estado(ESTADO_INICIO);
+    sched_run(); // Não retorna; dorme em __wfi() quando não há eventos
 }
 
 // Implementações das funções
 
 void exibir_acertos(int acertos) {
-    ssd1306_fill(&display, false); // Limpa o display
-    ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-    char msg[20];
-    snprintf(msg, sizeof(msg), "Acertos: %d", acertos);
-    ssd1306_draw_string(&display, msg, 20, 20); // Exibe a mensagem no display
-    ssd1306_send_data(&display);
+    mostrar_tela(&tela_acertos, &acertos);
 }
 
-void piscar_led() {
-    gpio_put(LED_PIN, 1); // Acende o LED
-    sleep_ms(200);        // Mantém o LED aceso por 200ms
-    gpio_put(LED_PIN, 0); // Apaga o LED
-}
-
-bool debounce_button_a() {
-    uint64_t current_time = time_us_64();
-    if (current_time - last_button_a_time > DEBOUNCE_TIME_MS * 1000) {
-        last_button_a_time = current_time;
-        return true;
-    }
-    return false;
+// Pede ao núcleo de saída para desenhar e enviar a tela
+void mostrar_tela(screen_t *tela, const int *valores) {
+    output_screen(tela, valores);
 }
 
-bool debounce_button_b() {
-    uint64_t current_time = time_us_64();
-    if (current_time - last_button_b_time > DEBOUNCE_TIME_MS * 1000) {
-        last_button_b_time = current_time;
-        return true;
-    }
-    return false;
-}
+// Roda no núcleo dono das saídas, antes de ele começar a atender comandos
+void inicializar_saidas() {
+    ws2812_init(PINO_MATRIZ);
+    ws2812_show(matriz, 25); // Matriz apagada
 
-void button_a_callback() {
-    if (!tempo_definido && debounce_button_a()) {
-        tempo_espera += TEMPO_BASE;
-        printf("Tempo ajustado: %d segundos\n", tempo_espera / 1000000);  // Imprime no console
-        piscar_led(); // Pisca o LED para feedback visual
-    }
-}
-
-void button_b_callback(uint gpio, uint32_t events) {
-    if (gpio == BUTTON_B_PIN && debounce_button_b()) {
-        button_b_pressed = true;
-
-        // Se o tempo ainda não foi definido, confirma o tempo
-        if (!tempo_definido) {
-            ssd1306_fill(&display, false);
-            ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-            ssd1306_draw_string(&display, "Definido", 40, 20);
-            ssd1306_draw_string(&display, "Aguarde", 20, 40);
-            ssd1306_send_data(&display);
-            tempo_definido = true;
-            start_time = time_us_64();
-            printf("Tempo definido: %d segundos\n", tempo_espera / 1000000);
-        }
-
-        // Se o alarme está ativo, interrompe o buzzer
-        if (buzzer_active) {
-            buzzer_active = false;
-            pwm_set_gpio_level(BUZZER_PIN, 0);
-
-            // Exibe a mensagem no OLED
-            ssd1306_fill(&display, false);
-            ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-            ssd1306_draw_string(&display, "Alarme", 40, 20);
-            ssd1306_draw_string(&display, "desligado", 20, 35);
-            ssd1306_draw_string(&display, "Aguarde", 30, 50);
-            ssd1306_send_data(&display);
-
-            // Imprime no monitor serial que o alarme foi pausado
-            printf("Alarme pausado pelo botão B\n");
-        }
-    }
-}
-
-void emitir_alerta() {
+    ssd1306_init(&display, 128, 64, false, OLED_ADDR, I2C_PORT);
+    ssd1306_config(&display);
     ssd1306_fill(&display, false);
-    ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-    ssd1306_draw_string(&display, "Pausa!", 40, 20);
-    ssd1306_draw_string(&display, "Pressione B", 20, 40);
     ssd1306_send_data(&display);
 
-    buzzer_active = true;
-    beep(BUZZER_PIN, 15000); // Toca o buzzer
-
-    printf("Alarme emitido! Aguardando interrupção...\n");
-
-    while (!button_b_pressed) {
-        sleep_ms(100);
-    }
-
-    start_time = time_us_64();
-    button_b_pressed = false;
+    pwm_init_buzzer(BUZZER_PIN);
+    pcm_init(BUZZER_PIN);
 }
 
-void inicializar_matriz(uint pino) {
-    uint offset = pio_add_program(pio0, &matriz_led_program); // Adiciona o programa PIO
-    pio_matriz = pio0; // Usa o controlador PIO0
-
-    maquina = pio_claim_unused_sm(pio_matriz, false); // Obtém uma máquina de estado livre
-    if (maquina < 0) {
-        pio_matriz = pio1; // Se não houver máquinas livres no PIO0, tenta no PIO1
-        maquina = pio_claim_unused_sm(pio_matriz, true);
-    }
+void piscar_led() {
+    gpio_put(LED_PIN, 1); // Acende o LED
+    sched_timer_start(&timer_led, EV_LED_FIM, 200000, false); // Apaga após 200ms
+}
 
-    // Inicializa o programa PIO na máquina de estado
-    matriz_led_program_init(pio_matriz, maquina, offset, pino, 800000.f);
+// Evento de botão recém pressionado (ignora soltura e long-press)
+bool pressionou(const sched_event_t *ev, uint16_t botao) {
+    return ev->id == botao && ev->arg == INPUT_PRESS;
 }
 
-void limpar_matriz() {
-    for (int i = 0; i < 25; i++) {
-        matriz[i][0] = 0; // Vermelho
-        matriz[i][1] = 0; // Verde
-        matriz[i][2] = 0; // Azul
-    }
+// O sequenciador do buzzer toca e termina sozinho; nada aqui bloqueia
+void iniciar_beep(const buzzer_melody_t *melodia) {
+    output_buzzer(melodia);
 }
 
-void atualizar_linha(int linha) {
-    for (int coluna = 0; coluna < 5; coluna++) {
-        int indice = linha * 5 + coluna; // Calcula o índice do LED na matriz
-        pio_sm_put_blocking(pio_matriz, maquina, matriz[indice][1]); // Verde
-        pio_sm_put_blocking(pio_matriz, maquina, matriz[indice][0]); // Vermelho
-        pio_sm_put_blocking(pio_matriz, maquina, matriz[indice][2]); // Azul
-    }
+void parar_beep() {
+    output_buzzer(NULL);
 }
 
-void atualizar_matriz() {
-    for (int linha = 0; linha < 5; linha++) {
-        atualizar_linha(linha); // Atualiza uma linha inteira de cada vez
+// Tempo até o alarme: em minutos, ou em segundos no fim da contagem
+void mostrar_restante() {
+    uint64_t agora = time_us_64();
+    int segundos = fim_contagem > agora ? (int)((fim_contagem - agora + 999999) / 1000000) : 0;
+    if (segundos >= 120) {
+        int minutos = (segundos + 59) / 60;
+        mostrar_tela(&tela_restante_min, &minutos);
+    } else {
+        mostrar_tela(&tela_restante_s, &segundos);
     }
 }
 
-void desenhar_ponto(int x, int y, int cor, int intensidade) {
-    y = 4 - y; // Inverte o eixo Y (0 → 4, 1 → 3, etc.)
+// Acende a tela da contagem por `duracao_us`; depois EV_TELA a apaga de novo
+void acender_tela(power_state_t modo, uint32_t duracao_us) {
+    power_set(modo);
+    sched_timer_start(&timer_tela, EV_TELA, duracao_us, false);
+}
 
-    int indice;
-    if (y % 2 == 0) {
-        indice = y * 5 + x;
-    } else {
-        indice = y * 5 + (4 - x);
+// Ações de entrada de cada estado
+void entrar_estado(estado_t novo) {
+    if (estado == ESTADO_ALONGAMENTO)
+        output_scroll_stop(); // Painel inteiro de volta para a próxima tela
+    estado = novo;
+    sched_timer_stop(&timer_estado);
+    sched_timer_stop(&timer_tick);
+    sched_timer_stop(&timer_quadro);
+    sched_timer_stop(&timer_tela);
+    anim_stop(); // Animações não passam de um estado para outro
+    power_set(POWER_ACTIVE); // Só a contagem economiza energia
+
+    switch (estado) {
+    case ESTADO_INICIO:
+        mostrar_tela(&tela_inicio, NULL);
+        break;
+
+    case ESTADO_CONFIG: {
+        int segundos = tempo_espera / 1000000;
+        mostrar_tela(&tela_config, &segundos);
+        break;
     }
 
-    if (indice >= 0 && indice < 25) {
-        if (cor == 0) { // Vermelho
-            matriz[indice][0] = intensidade;
-        } else if (cor == 1) { // Verde
-            matriz[indice][1] = intensidade;
-        } else if (cor == 2) { // Azul
-            matriz[indice][2] = intensidade;
-        }
-    } else {
-        printf("Erro: Índice fora dos limites! x: %d, y: %d, indice: %d\n", x, y, indice);
-    }
-}
+    case ESTADO_CONTAGEM:
+        mostrar_tela(&tela_definido, NULL);
+        printf("Tempo definido: %d segundos\n", tempo_espera / 1000000);
+        fim_contagem = time_us_64() + tempo_espera;
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, tempo_espera, false);
+        if (PERIODO_ESPIADA_US)
+            sched_timer_start(&timer_tick, EV_TICK, PERIODO_ESPIADA_US, true);
+        // A tela se apaga depois; até o alarme o núcleo só acorda por um botão
+        sched_timer_start(&timer_tela, EV_TELA, TEMPO_TELA_ACESA_US, false);
+        break;
+
+    case ESTADO_ALERTA:
+        mostrar_tela(&tela_pausa, NULL);
+        iniciar_beep(&melodia_alarme); // Toca o buzzer até B ou por 15 s
+        printf("Alarme emitido! Aguardando interrupção...\n");
+        break;
+
+    case ESTADO_ALARME_DESLIGADO:
+        mostrar_tela(&tela_alarme_desligado, NULL);
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, 1000000, false);
+        break;
+
+    case ESTADO_REFLEXO_META:
+        acertos = 0; // Reinicia o contador de acertos
+        hist_reset(&reacoes);
+        mover_ponto_alvo(); // Move o ponto alvo para uma posição aleatória
+        mostrar_tela(&tela_meta, NULL); // Exibe a meta de acertos antes de iniciar o teste
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, TEMPO_META_US, false);
+        break;
 
-void animacao_piscar() {
-    for (int i = 0; i < 3; i++) { // Repete a animação 3 vezes
+    case ESTADO_REFLEXO_JOGO:
+        mostrar_tela(&tela_ache_ponto, NULL);
         limpar_matriz();
-        for (int j = 0; j < 25; j++) {
-            matriz[j][1] = 128; // Acende todos os LEDs em verde
-        }
+        desenhar_alvo();
+        desenhar_ponto(CAMADA_CURSOR, posicao_usuario_x, posicao_usuario_y, 0, 128, 0);
         atualizar_matriz();
-        sleep_ms(200); // Mantém os LEDs acesos por 200ms
+        cursor_place(&cursor, posicao_usuario_x, posicao_usuario_y);
+        tempo_jogo = time_us_64();
+        matriz_suja = false;
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, TEMPO_LIMITE_US, false);
+        sched_timer_start(&timer_tick, EV_TICK, CURSOR_STEP_US, true);
+        sched_timer_start(&timer_quadro, EV_QUADRO, PERIODO_QUADRO_US, true);
+        break;
+
+    case ESTADO_REFLEXO_SUCESSO:
+        preencher_matriz(128, 128, 0); // Acende os LEDs da matriz em amarelo
+        atualizar_matriz();
+        mostrar_tela(&tela_parabens, NULL);
+        printf("Meta de 10 acertos alcançada!\n");
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, 3000000, false);
+        break;
 
+    case ESTADO_REFLEXO_FALHA:
+        preencher_matriz(128, 0, 0); // Acende os LEDs da matriz em vermelho
+        atualizar_matriz();
+        mostrar_tela(&tela_tempo_esgotado, NULL); // Aguarda B para tentar novamente
+        break;
+
+    case ESTADO_REFLEXO_RESULTADO:
+        relatorio_reacoes();
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, TEMPO_RESULTADO_US, false);
+        break;
+
+    case ESTADO_ANIMACAO_FINAL:
+        printf("Teste finalizado!\n");
+        tempo_espera = 0; // Zera o tempo configurado
+        limpar_matriz(); // Apaga todos os LEDs da matriz
+        anim_play(&anim_linhas); // B pula a animação
+        break;
+
+    case ESTADO_DESCANSO:
         limpar_matriz();
         atualizar_matriz();
-        sleep_ms(200); // Mantém os LEDs apagados por 200ms
+        tempo_restante = 20; // Tempo inicial de 20 segundos
+        mostrar_tela(&tela_descanso, &tempo_restante);
+        sched_timer_start(&timer_tick, EV_TICK, 1000000, true);
+        break;
+
+    case ESTADO_PAUSA_CONCLUIDA:
+        mostrar_tela(&tela_pausa_concluida, NULL);
+        anim_play(&anim_esmaecer);
+        output_sound(&clip_chime);
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, 2000000, false);
+        break;
+
+    case ESTADO_ALONGAMENTO:
+        tempo_restante = 10; // Contagem regressiva de 10 segundos
+        output_scroll_start(textos_alongamento[exercicio].linhas, textos_alongamento[exercicio].quantidade, tempo_restante);
+        sched_timer_start(&timer_tick, EV_TICK, 1000000, true);
+        sched_timer_start(&timer_quadro, EV_QUADRO, PERIODO_ROLAGEM_US, true);
+        break;
+
+    case ESTADO_ALONGAMENTO_CONFIRMA:
+        mostrar_tela(&tela_confirma_joystick, NULL);
+        anim_play(&anim_giro);
+        sched_timer_start(&timer_tick, EV_TICK, PERIODO_JOYSTICK_US, true);
+        break;
+
+    case ESTADO_ALONGAMENTO_PISCAR:
+        iniciar_beep(&melodia_beep_curto); // Feedback sonoro
+        anim_play(&anim_piscar); // Pisca a matriz em verde 3 vezes; B pula
+
+        break;
+
+    case ESTADO_ALONGAMENTOS_FIM: {
+        mostrar_tela(&tela_alongamentos_fim, NULL);
+        historico.ciclos++;
+        kvlog_set(CHAVE_HISTORICO, &historico, sizeof(historico)); // Gravado na configuração
+        output_sound(&clip_ding); // Os dois clipes tocam juntos no mixer
+        output_sound(&clip_chime);
+        sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, 2000000, false);
+        sched_stats_t stats;
+        input_stats_t entrada;
+        sched_get_stats(&stats, true);
+        input_get_stats(&entrada, true);
+        output_stats_t saida;
+        output_get_stats(&saida, true);
+        uint64_t janela_ms = stats.window_us / 1000 ? stats.window_us / 1000 : 1;
+        printf("IRQ dos botoes: %lu bordas, %lu perdidas\n",
+               (unsigned long)entrada.edges, (unsigned long)entrada.dropped);
+        printf("Nucleo 0: %lu voltas/s\n", (unsigned long)(stats.loops * 1000ull / janela_ms));
+        printf("Saidas (multicore=%d): %lu comandos, esperas %lu\n",
+               OUTPUT_MULTICORE, (unsigned long)saida.messages, (unsigned long)saida.stalls);
+#if PERF_ENABLED
+        // Tempos de CPU, para comparar os builds com e sem OUTPUT_MULTICORE.
+        // Ficam fora do simulador (host/), onde o relógio não anda durante o código.
+        uint64_t ocupado_us = stats.window_us - stats.idle_us;
+        printf("Latencia max: entrada %lu us, eventos %lu us\n",
+               (unsigned long)stats.input_latency_max_us, (unsigned long)stats.latency_max_us);
+        printf("IRQ dos botoes: max %lu ciclos\n", (unsigned long)entrada.isr_max_cycles);
+        printf("Nucleo 0: ocupado %lu us/s\n", (unsigned long)(ocupado_us * 1000 / janela_ms));
+        printf("Saidas: nucleo 0 %lu us (max %lu), execucao %lu us\n",
+               (unsigned long)saida.core0_us, (unsigned long)saida.core0_max_us,
+               (unsigned long)saida.core1_busy_us);
+        printf("Parada do buzzer: max %lu us\n", (unsigned long)saida.buzzer_stop_max_us);
+#endif
+
+        ws2812_stats_t leds;
+        ws2812_get_stats(&leds, true);
+        printf("Matriz: %lu quadros enviados, %lu repetidos suprimidos\n",
+               (unsigned long)leds.sent, (unsigned long)leds.suppressed);
+        break;
+    }
     }
 }
 
-void alongamento_guiado() {
-    // Lista de alongamentos com instruções curtas
-    char *instrucoes[4] = {
-        "Se alongue",            // 1º exercício
-        "Gire ombros",           // 2º exercício
-        "Alongue pescoço",       // 3º exercício
-        "Pisque olhos"           // 4º exercício
-    };
-
-    for (int i = 0; i < 4; i++) {
-        // Limpa o display e desenha o retângulo
-        ssd1306_fill(&display, false); // Limpa o buffer
-        ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-        ssd1306_draw_string(&display, instrucoes[i], 17, 20); // Centraliza a mensagem
-        ssd1306_send_data(&display); // Envia os dados para o display
-
-        // Inicia a contagem regressiva de 10 segundos
-        int tempo_restante = 10;
-        while (tempo_restante > 0) {
-            // Atualiza o display com o tempo restante
-            char msg[20];
-            snprintf(msg, sizeof(msg), "Tempo: %d", tempo_restante); // Remove o "s" para evitar sobreposição
-            ssd1306_fill(&display, false); // Limpa o buffer
-            ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Redesenha o retângulo
-            ssd1306_draw_string(&display, instrucoes[i], 17, 20); // Redesenha a instrução
-            ssd1306_draw_string(&display, msg, 40, 40); // Exibe o tempo restante
-            ssd1306_send_data(&display); // Envia os dados para o display
-
-            sleep_ms(1000); // Aguarda 1 segundo
-            tempo_restante--; // Decrementa o tempo restante
-        }
+// Handler do agendador: transições da máquina de estados
+void tratar_evento(const sched_event_t *ev) {
+    if (ev->id == EV_LED_FIM) {
+        gpio_put(LED_PIN, 0);
+        return;
+    }
 
-        // Feedback sonoro ao final do alongamento
-        beep(BUZZER_PIN, 500); // Toca um beep de 500ms
-        sleep_ms(500); // Aguarda 500ms para evitar repetição
-        pwm_set_gpio_level(BUZZER_PIN, 0); // Desliga o buzzer
+    switch (estado) {
+    case ESTADO_INICIO:
+        if (pressionou(ev, EV_BOTAO_A))
+            entrar_estado(ESTADO_CONFIG);
+        break;
+
+    case ESTADO_CONFIG:
+        if (pressionou(ev, EV_BOTAO_A)) {
+            tempo_espera += TEMPO_BASE;
+            printf("Tempo ajustado: %d segundos\n", tempo_espera / 1000000);  // Imprime no console
+            piscar_led(); // Pisca o LED para feedback visual
+            int segundos = tempo_espera / 1000000;
+            mostrar_tela(&tela_config, &segundos);
+        } else if (ev->id == EV_BOTAO_A && ev->arg == INPUT_LONG_PRESS) {
+            tempo_espera = 0; // Segurar A zera o tempo configurado
+            printf("Tempo zerado\n");
+            int segundos = 0;
+            mostrar_tela(&tela_config, &segundos);
+        } else if (pressionou(ev, EV_BOTAO_B)) {
+            kvlog_set(CHAVE_TEMPO, &tempo_espera, sizeof(tempo_espera)); // Gravado na contagem
+            entrar_estado(ESTADO_CONTAGEM);
+        }
+        break;
+
+    case ESTADO_CONTAGEM:
+        if (ev->id == EV_TEMPO_ESTADO) {
+            entrar_estado(ESTADO_ALERTA);
+        } else if (ev->id == EV_BOTAO_A && ev->arg == INPUT_LONG_PRESS) {
+            entrar_estado(ESTADO_CONFIG);
+        } else if (ev->id == EV_TELA) {
+            power_set(POWER_OFF);
+        } else if (ev->id == EV_TICK && power_get() == POWER_OFF) {
+            mostrar_restante();
+            acender_tela(POWER_DIM, TEMPO_ESPIADA_US);
+        } else if (pressionou(ev, EV_BOTAO_A) || pressionou(ev, EV_BOTAO_B) ||
+                   pressionou(ev, EV_BOTAO_JOYSTICK)) {
+            mostrar_restante(); // Qualquer botão acorda a tela
+            acender_tela(POWER_ACTIVE, TEMPO_TELA_ACESA_US);
+        }
+        break;
 
-        // Exibe mensagem para confirmar o alongamento
-        ssd1306_fill(&display, false); // Limpa o buffer
-        ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-        ssd1306_draw_string(&display, "Pressione o", 20, 20);
-        ssd1306_draw_string(&display, "joystick", 30, 35);
-        ssd1306_send_data(&display); // Envia os dados para o display
+    case ESTADO_ALERTA:
+        if (pressionou(ev, EV_BOTAO_B)) {
+            parar_beep();
+            printf("Alarme pausado pelo botão B\n");
+            entrar_estado(ESTADO_ALARME_DESLIGADO);
+        }
+        break;
+
+    case ESTADO_ALARME_DESLIGADO:
+        if (ev->id == EV_TEMPO_ESTADO)
+            entrar_estado(ESTADO_REFLEXO_META);
+        break;
+
+    case ESTADO_REFLEXO_META:
+        if (ev->id == EV_TEMPO_ESTADO)
+            entrar_estado(ESTADO_REFLEXO_JOGO);
+        break;
+
+    case ESTADO_REFLEXO_JOGO:
+        if (ev->id == EV_TICK) {
+            passo_reflexo(ev->timestamp);
+        } else if (ev->id == EV_QUADRO) {
+            if (matriz_suja) {
+                matriz_suja = false;
+                atualizar_matriz();
+            }
+        } else if (ev->id == EV_TEMPO_ESTADO) {
+            entrar_estado(ESTADO_REFLEXO_RESULTADO);
+        }
+        break;
+
+    case ESTADO_REFLEXO_SUCESSO:
+        if (ev->id == EV_TEMPO_ESTADO)
+            entrar_estado(ESTADO_REFLEXO_RESULTADO);
+        break;
+
+    case ESTADO_REFLEXO_RESULTADO:
+        if (ev->id == EV_TEMPO_ESTADO)
+            entrar_estado(acertos >= META_ACERTOS ? ESTADO_ANIMACAO_FINAL : ESTADO_REFLEXO_FALHA);
+        break;
+
+    case ESTADO_REFLEXO_FALHA:
+        if (pressionou(ev, EV_BOTAO_B)) {
+            printf("Reiniciando o teste de reflexo...\n"); // Imprime no monitor serial
+            entrar_estado(ESTADO_REFLEXO_META);
+        }
+        break;
+
+    case ESTADO_ANIMACAO_FINAL:
+        if (ev->id == EV_ANIMACAO && ev->arg != ANIM_DONE)
+            iniciar_beep(&melodia_beep); // Beep a cada linha acesa
+        else if ((ev->id == EV_ANIMACAO && ev->arg == ANIM_DONE) || pressionou(ev, EV_BOTAO_B))
+            entrar_estado(ESTADO_DESCANSO);
+        break;
+
+    case ESTADO_DESCANSO:
+        if (ev->id == EV_TICK) {
+            if (--tempo_restante > 0) {
+                mostrar_tela(&tela_descanso, &tempo_restante);
+            } else {
+                // Beep simples para alertar o fim do tempo
+                sched_timer_stop(&timer_tick);
+                iniciar_beep(&melodia_beep);
+                sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, PAUSA_BEEP_US, false);
+            }
+        } else if (ev->id == EV_TEMPO_ESTADO) {
+            entrar_estado(ESTADO_PAUSA_CONCLUIDA);
+        }
+        break;
 
-        // Aguarda a confirmação do usuário com o joystick
-        bool confirmado = false;
-        while (!confirmado) {
-            uint16_t x_raw, y_raw;
-            ler_joystick(&x_raw, &y_raw);
+    case ESTADO_PAUSA_CONCLUIDA:
+        if (ev->id == EV_TEMPO_ESTADO) {
+            exercicio = 0;
+            entrar_estado(ESTADO_ALONGAMENTO);
+        }
+        break;
+
+    case ESTADO_ALONGAMENTO:
+        if (ev->id == EV_TICK) {
+            if (--tempo_restante > 0) {
+                output_scroll_value(tempo_restante);
+            } else {
+                // Feedback sonoro ao final do alongamento
+                sched_timer_stop(&timer_tick);
+                iniciar_beep(&melodia_beep);
+                sched_timer_start(&timer_estado, EV_TEMPO_ESTADO, PAUSA_BEEP_US, false);
+            }
+        } else if (ev->id == EV_QUADRO) {
+            output_scroll_step(); // Só a start line muda; uma página a cada 8 passos
+        } else if (ev->id == EV_TEMPO_ESTADO) {
+            entrar_estado(ESTADO_ALONGAMENTO_CONFIRMA);
+        }
+        break;
 
+    case ESTADO_ALONGAMENTO_CONFIRMA:
+        if (pressionou(ev, EV_BOTAO_JOYSTICK)) {
+            entrar_estado(ESTADO_ALONGAMENTO_PISCAR);
+        } else if (ev->id == EV_TICK) {
             int movimento_x, movimento_y;
-            mapear_joystick_para_matriz(x_raw, y_raw, &movimento_x, &movimento_y);
+            mapear_joystick_para_matriz(&movimento_x, &movimento_y);
 
             // Confirma se o usuário moveu o joystick em qualquer direção
-            if (movimento_x != 0 || movimento_y != 0) {
-                confirmado = true;
-                beep(BUZZER_PIN, 200); // Feedback sonoro
-                animacao_piscar(); // Confirma na matriz de LEDs
-            }
+            if (movimento_x != 0 || movimento_y != 0)
+                entrar_estado(ESTADO_ALONGAMENTO_PISCAR);
+        }
+        break;
 
-            sleep_ms(100); // Pequeno delay para evitar uso excessivo da CPU
+    case ESTADO_ALONGAMENTO_PISCAR:
+        if ((ev->id == EV_ANIMACAO && ev->arg == ANIM_DONE) || pressionou(ev, EV_BOTAO_B)) {
+            limpar_matriz();
+            atualizar_matriz();
+            if (++exercicio < 4)
+                entrar_estado(ESTADO_ALONGAMENTO);
+            else
+                entrar_estado(ESTADO_ALONGAMENTOS_FIM);
         }
+        break;
 
-        // Limpa a matriz de LEDs após a confirmação
-        limpar_matriz();
-        atualizar_matriz();
-        sleep_ms(500); // Pequena pausa entre os alongamentos
+    case ESTADO_ALONGAMENTOS_FIM:
+        if (ev->id == EV_TEMPO_ESTADO)
+            entrar_estado(ESTADO_CONFIG); // O ciclo recomeça na configuração
+        break;
     }
-
-    // Exibe mensagem de conclusão
-    ssd1306_fill(&display, false); // Limpa o buffer
-    ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-    ssd1306_draw_string(&display, "Alongamentos", 20, 20);
-    ssd1306_draw_string(&display, "finalizados!", 20, 35);
-    ssd1306_send_data(&display); // Envia os dados para o display
-    sleep_ms(2000); // Mostra a mensagem por 2 segundos
 }
 
-void descansar_olhos() {
-    limpar_matriz();
-    atualizar_matriz();
-
-    int tempo_restante = 20; // Tempo inicial de 20 segundos
-
-    while (tempo_restante > 0) {
-        // Atualiza o display com o tempo restante
-        ssd1306_fill(&display, false); // Limpa o buffer
-        ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-        char msg[20];
-        snprintf(msg, sizeof(msg), "Feche os olhos: %d", tempo_restante); // Remove o "s" para evitar sobreposição
-        ssd1306_draw_string(&display, msg, 7, 25);
-        ssd1306_send_data(&display); // Envia os dados para o display
+// Avança o teste de reflexo em passos fixos de CURSOR_STEP_US até `agora`.
+// Um tick atrasado é compensado com mais passos, então a velocidade do
+// cursor não depende da latência do laço. O acerto é conferido a cada passo;
+// o desenho só marca a matriz, que é enviada no próximo EV_QUADRO.
+void passo_reflexo(uint64_t agora) {
+    // Lê o joystick (média filtrada, já sem a zona morta); eixos invertidos
+    int16_t x, y;
+    joystick_read(&x, &y);
+
+    while (agora - tempo_jogo >= CURSOR_STEP_US) {
+        tempo_jogo += CURSOR_STEP_US;
+        cursor_step(&cursor, -x, -y);
+
+        int celula_x = cursor_cell_x(&cursor);
+        int celula_y = cursor_cell_y(&cursor);
+        if (celula_x != posicao_usuario_x || celula_y != posicao_usuario_y) {
+            posicao_usuario_x = celula_x;
+            posicao_usuario_y = celula_y;
+            desenhar_ponto(CAMADA_CURSOR, posicao_usuario_x, posicao_usuario_y, 0, 128, 0); // Jogador em verde
+            matriz_suja = true;
+        }
 
-        sleep_ms(1000); // Aguarda 1 segundo
-        tempo_restante--; // Decrementa o tempo restante
+        // Se o jogador alcançar o ponto alvo
+        if (posicao_usuario_x == posicao_alvo_x && posicao_usuario_y == posicao_alvo_y) {
+            // Reação: do alvo aceso nos LEDs até o passo em que o cursor chegou.
+            // Um alvo que ainda não acendeu (ou surgiu sob o cursor) não conta.
+            // Diferença em 32 bits: certa para intervalos de até ~71 min
+            uint32_t aceso_us = alvo_aceso_us[alvo_carimbo];
+            int32_t reacao = (int32_t)((uint32_t)tempo_jogo - aceso_us);
+            if (aceso_us && reacao > 0) {
+                tempo_resposta = reacao;
+                hist_add(&reacoes, tempo_resposta);
+            }
+            acertos++;
+            printf("Acerto %d! Movendo o alvo...\n", acertos);
+            exibir_acertos(acertos); // Atualiza o display com a quantidade de acertos
+            mover_ponto_alvo(); // Move o alvo para um novo local
+            desenhar_alvo();
+            matriz_suja = true;
+
+            // Verifica se o jogador atingiu a meta de acertos
+            if (acertos >= META_ACERTOS) {
+                entrar_estado(ESTADO_REFLEXO_SUCESSO);
+                return;
+            }
+        }
     }
+}
 
-    // Beep simples para alertar o fim do tempo
-    beep(BUZZER_PIN, 500); // Toca um beep de 500ms
-    sleep_ms(500); // Aguarda 500ms para evitar repetição
-    pwm_set_gpio_level(BUZZER_PIN, 0); // Desliga o buzzer
-
-    // Exibe a mensagem final e retorna ao estado inicial
-    ssd1306_fill(&display, false); // Limpa o buffer
-    ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-    ssd1306_draw_string(&display, "Pausa", 15, 20);
-    ssd1306_draw_string(&display, "Concluida", 10, 35);
-    ssd1306_send_data(&display); // Envia os dados para o display
-    sleep_ms(2000); // Mostra a mensagem por 2 segundos
-
-    // Chama a função de alongamento guiado
-    alongamento_guiado();
+void limpar_matriz() {
+    matrix_clear(CAMADA_FUNDO);
+    matrix_clear(CAMADA_ALVO);
+    matrix_clear(CAMADA_CURSOR);
 }
 
-void animacao_final() {
-    limpar_matriz(); // Apaga todos os LEDs da matriz
+void preencher_matriz(uint8_t r, uint8_t g, uint8_t b) {
+    limpar_matriz();
+    matrix_fill(CAMADA_FUNDO, r, g, b);
+}
 
-    for (int linha = 0; linha < 5; linha++) { // Itera sobre cada linha
-        for (int coluna = 0; coluna < 5; coluna++) { // Itera sobre cada coluna da linha
-            int indice = linha * 5 + coluna; // Calcula o índice do LED na matriz
-            matriz[indice][0] = 128; // Vermelho (50% de brilho)
-            matriz[indice][1] = 128; // Verde (50% de brilho)
-            matriz[indice][2] = 0;  // Azul (desligado)
-        }
+// Compõe as camadas (gama e limite de brilho incluídos) e envia uma cópia do
+// quadro ao núcleo de saída; `matriz` continua livre logo em seguida
+void atualizar_matriz() {
+    PERF_BEGIN();
+    TRACE(TRACE_MATRIX_BEGIN, 0);
+    matrix_compose(matriz);
+    if (alvo_novo) {
+        alvo_novo = false;
+        output_matrix_stamped(matriz, &alvo_aceso_us[alvo_carimbo]); // A reação conta a partir daqui
+    } else {
+        output_matrix(matriz);
+    }
+    TRACE(TRACE_MATRIX_END, 0);
+    PERF_END(PERF_MATRIX);
+}
 
-        atualizar_matriz(); // Atualiza a matriz com a nova linha acesa
-        beep(BUZZER_PIN, 500); // Toca o buzzer por 500ms
-        sleep_ms(500); // Aguarda 500ms antes de acender a próxima linha
+// Redesenha o alvo em vermelho; o instante em que ele acender nos LEDs é
+// registrado no próximo quadro enviado
+void desenhar_alvo() {
+    desenhar_ponto(CAMADA_ALVO, posicao_alvo_x, posicao_alvo_y, 128, 0, 0);
+    alvo_carimbo = (alvo_carimbo + 1) % ALVO_CARIMBOS;
+    alvo_aceso_us[alvo_carimbo] = 0;
+    alvo_novo = true;
+}
+
+// Estatísticas de reação da sessão no display (ms) e na USB (µs)
+void relatorio_reacoes() {
+    bool vazio = reacoes.count == 0;
+    uint32_t minimo = vazio ? 0 : reacoes.min;
+    uint32_t media = hist_mean(&reacoes);
+    uint32_t p50 = hist_percentile(&reacoes, 50);
+    uint32_t p95 = hist_percentile(&reacoes, 95);
+
+    int valores[] = {minimo / 1000, media / 1000, p50 / 1000, p95 / 1000, reacoes.max / 1000};
+    mostrar_tela(&tela_reacao, valores);
+    printf("Reacao (%lu alvos): min %lu us, media %lu us, p50 %lu us, p95 %lu us, max %lu us\n",
+           (unsigned long)reacoes.count, (unsigned long)minimo, (unsigned long)media,
+           (unsigned long)p50, (unsigned long)p95, (unsigned long)reacoes.max);
+
+    historico.testes_reflexo++;
+    if (!vazio) {
+        if (historico.melhor_reacao_us == 0 || minimo < historico.melhor_reacao_us)
+            historico.melhor_reacao_us = minimo;
+        historico.ultima_media_us = media;
     }
+    kvlog_set(CHAVE_HISTORICO, &historico, sizeof(historico));
+}
 
-    // Desliga o buzzer após a animação
-    pwm_set_gpio_level(BUZZER_PIN, 0);
+// A flash só é gravada com o fluxo parado esperando o usuário ou o alarme, e
+// sem clipe PCM tocando: o DMA toca os blocos na RAM, mas é a IRQ do mixer
+// que os enche a partir dos clipes na flash, e ela não roda durante a
+// operação. Gravar uma página leva ~1 ms, e as bordas dos botões ficam
+// guardadas no banco de IO até as IRQs voltarem. Um apagamento de setor leva
+// dezenas de ms e juntaria bordas, então fica para a tela inicial ou para a
+// contagem com a tela já fraca ou apagada (ninguém mexeu por 10 s).
+bool gravacao_liberada(bool apagar) {
+    if (pcm_playing())
+        return false;
+    if (apagar)
+        return estado == ESTADO_INICIO || (estado == ESTADO_CONTAGEM && power_get() != POWER_ACTIVE);
+    return estado == ESTADO_INICIO || estado == ESTADO_CONFIG || estado == ESTADO_CONTAGEM;
+}
 
-    // Chama a função para descansar os olhos
-    descansar_olhos();
+void relatorio_historico() {
+    kvlog_stats_t flash;
+    kvlog_get_stats(&flash, false);
+    printf("Historico: %lu ciclos, %lu testes de reflexo, melhor reacao %lu us, ultima media %lu us\n",
+           (unsigned long)historico.ciclos, (unsigned long)historico.testes_reflexo,
+           (unsigned long)historico.melhor_reacao_us, (unsigned long)historico.ultima_media_us);
+    printf("Flash: %lu gravacoes, %lu compactacoes, %lu apagamentos, %lu slots perdidos, "
+           "%lu falhas (%lu seguidas), operacao max %lu us, boot %lu us%s%s\n",
+           (unsigned long)flash.appends, (unsigned long)flash.compactions, (unsigned long)flash.erases,
+           (unsigned long)flash.crc_errors, (unsigned long)flash.failures, (unsigned long)flash.fail_streak,
+           (unsigned long)flash.op_max_us, (unsigned long)flash.boot_us,
+           kvlog_pending() ? ", gravacao pendente" : "",
+           kvlog_failed() ? ", FLASH COM FALHA" : "");
 }
 
-void ler_joystick(uint16_t *x, uint16_t *y) {
-    adc_select_input(1); // Seleciona o eixo X (pino 27)
-    *x = adc_read(); // Lê o valor do eixo X
-    adc_select_input(0); // Seleciona o eixo Y (pino 26)
-    *y = adc_read(); // Lê o valor do eixo Y
+// Redesenha a camada com um único ponto, em coordenadas lógicas (y para cima)
+void desenhar_ponto(uint8_t camada, int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+    matrix_clear(camada);
+    matrix_set(camada, x, y, r, g, b);
 }
 
 void mover_ponto_alvo() {
@@ -500,139 +892,25 @@ void mover_ponto_alvo() {
     posicao_alvo_y = rand() % 5; // Gera um número aleatório entre 0 e 4
 }
 
-void mapear_joystick_para_matriz(uint16_t x_raw, uint16_t y_raw, int *movimento_x, int *movimento_y) {
+void mapear_joystick_para_matriz(int *movimento_x, int *movimento_y) {
+    int16_t x, y;
+    joystick_read(&x, &y); // Última média do anel do DMA, relativa ao centro
+
     // Mapeia o eixo X (pino 27)
-    if (x_raw < CENTRO_ADC - LIMITE_JOYSTICK) {
+    if (x < 0) {
         *movimento_x = 1; // Movimento para a esquerda
-    } else if (x_raw > CENTRO_ADC + LIMITE_JOYSTICK) {
+    } else if (x > 0) {
         *movimento_x = -1; // Movimento para a direita
     } else {
         *movimento_x = 0; // Sem movimento
     }
 
     // Mapeia o eixo Y (pino 26)
-    if (y_raw < CENTRO_ADC - LIMITE_JOYSTICK) {
+    if (y < 0) {
         *movimento_y = 1; // Movimento para cima (eixo Y invertido)
-    } else if (y_raw > CENTRO_ADC + LIMITE_JOYSTICK) {
+    } else if (y > 0) {
         *movimento_y = -1; // Movimento para baixo (eixo Y invertido)
     } else {
         *movimento_y = 0; // Sem movimento
     }
 }
-
-void teste_reflexo() {
-    teste_em_andamento = true;
-    int acertos = 0; // Contador de acertos
-    int meta_acertos = 10; // Meta de acertos
-    uint64_t tempo_limite = 30000000; // 30s 
-    bool tentar_novamente = true;
-
-    while (tentar_novamente) {
-        acertos = 0; // Reinicia o contador de acertos
-        mover_ponto_alvo(); // Move o ponto alvo para uma posição aleatória
-
-        // Exibe a meta de acertos antes de iniciar o teste
-        ssd1306_fill(&display, false);
-        ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-        ssd1306_draw_string(&display, "Meta 10ac", 10, 20);
-        ssd1306_draw_string(&display, "Tempo 30s", 10, 35);
-        ssd1306_send_data(&display);
-        sleep_ms(3000); // Mostra a mensagem por 3 segundos
-
-        // Exibe a nova mensagem antes de iniciar o teste de reflexo
-        ssd1306_fill(&display, false);
-        ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-        ssd1306_draw_string(&display, "Ache o", 40, 20);
-        ssd1306_draw_string(&display, "ponto vermelho", 10, 35);
-        ssd1306_send_data(&display);
-
-        uint64_t inicio_teste = time_us_64();
-        while (acertos < meta_acertos && (time_us_64() - inicio_teste) < tempo_limite) {
-            // Lê o joystick
-            uint16_t x_raw, y_raw;
-            ler_joystick(&x_raw, &y_raw);
-
-            // Mapeia os valores do joystick para a matriz
-            int movimento_x, movimento_y;
-            mapear_joystick_para_matriz(x_raw, y_raw, &movimento_x, &movimento_y);
-
-            // Atualiza a posição do usuário com base no joystick
-            posicao_usuario_x += movimento_x;
-            posicao_usuario_y += movimento_y;
-
-            // Limita a posição do usuário aos limites da matriz
-            if (posicao_usuario_x < 0) posicao_usuario_x = 0;
-            if (posicao_usuario_x > 4) posicao_usuario_x = 4;
-            if (posicao_usuario_y < 0) posicao_usuario_y = 0;
-            if (posicao_usuario_y > 4) posicao_usuario_y = 4;
-
-            // Se o jogador alcançar o ponto alvo
-            if (posicao_usuario_x == posicao_alvo_x && posicao_usuario_y == posicao_alvo_y) {
-                acertos++;
-                printf("Acerto %d! Movendo o alvo...\n", acertos);
-                exibir_acertos(acertos); // Atualiza o display com a quantidade de acertos
-                mover_ponto_alvo(); // Move o alvo para um novo local
-            }
-
-            // Limpa a matriz e desenha os pontos
-            limpar_matriz();
-            desenhar_ponto(posicao_alvo_x, posicao_alvo_y, 0, 128); // Desenha o ponto alvo em vermelho (50% de brilho)
-            desenhar_ponto(posicao_usuario_x, posicao_usuario_y, 1, 128); // Desenha o ponto do usuário em azul (50% de brilho)
-            atualizar_matriz(); // Atualiza a matriz com os novos desenhos
-
-            sleep_ms(100); // Pequeno delay para evitar uso excessivo da CPU
-        }
-
-        // Verifica se o jogador atingiu a meta de acertos
-        if (acertos >= meta_acertos) {
-            // Acende os LEDs da matriz em amarelo (vermelho + verde)
-            for (int i = 0; i < 25; i++) {
-                matriz[i][0] = 128; // Vermelho
-                matriz[i][1] = 128; // Verde
-                matriz[i][2] = 0;  // Azul
-            }
-            atualizar_matriz();
-            ssd1306_fill(&display, false);
-            ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-            ssd1306_draw_string(&display, "Parabens!", 30, 20);
-            ssd1306_draw_string(&display, "Meta alcancada", 10, 35);
-            ssd1306_send_data(&display);
-            sleep_ms(3000); // Mostra a mensagem por 3 segundos
-            tentar_novamente = false; // Sai do loop de tentativas
-            printf("Meta de 10 acertos alcançada!\n"); // Imprime no monitor serial
-        } else {
-            // Acende os LEDs da matriz em vermelho
-            for (int i = 0; i < 25; i++) {
-                matriz[i][0] = 128; // Vermelho
-                matriz[i][1] = 0;   // Verde
-                matriz[i][2] = 0;   // Azul
-            }
-            atualizar_matriz();
-            ssd1306_fill(&display, false);
-            ssd1306_rect(&display, 0, 0, 128, 64, true, false); // Desenha um retângulo
-            ssd1306_draw_string(&display, "Tempo esgotado!", 10, 20);
-            ssd1306_draw_string(&display, "Pressione B para", 10, 35);
-            ssd1306_draw_string(&display, "tentar novamente", 10, 50);
-            ssd1306_send_data(&display);
-
-            // Aguarda a decisão do jogador
-            while (true) {
-                if (button_b_pressed) {
-                    button_b_pressed = false; // Reseta o estado do botão
-                    tentar_novamente = true; // Reinicia o teste
-                    printf("Reiniciando o teste de reflexo...\n"); // Imprime no monitor serial
-                    break;
-                }
-                sleep_ms(100); // Pequeno delay para evitar uso excessivo da CPU
-            }
-        }
-    }
-
-    printf("Teste finalizado!\n");
-    teste_em_andamento = false;
-    button_b_pressed = false; // Garante que o botão B não fique marcado
-    tempo_definido = false; // Permite reconfigurar o tempo
-    tempo_espera = 0; // Zera o tempo configurado
-
-    animacao_final(); // Chama a animação final apenas após o sucesso ou desistência
-}
\ No newline at end of file
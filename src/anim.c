@@ -0,0 +1,113 @@
+#include "anim.h"
+#include "sched.h"
+
+// Animações da matriz descritas como tabelas de quadros-chave (const, na
+// flash). Um temporizador periódico avança a animação a ANIM_FRAME_US; o
+// desenho acontece no contexto do agendador, fora de IRQ, e só quando o
+// quadro muda (troca de quadro-chave ou interpolação).
+
+static uint8_t anim_layer;
+static uint16_t anim_event;
+static void (*anim_present)(void);
+
+static const anim_t *current;
+static uint8_t key_index;
+static uint32_t elapsed_ms;
+static bool dirty;
+static sched_timer_t frame_timer;
+
+static void anim_draw(void) {
+  const anim_key_t *key = &current->keys[key_index];
+  uint8_t r = key->r, g = key->g, b = key->b;
+
+  if ((key->flags & ANIM_TWEEN) && key->ms > 0) {
+    uint8_t next = key_index + 1 < current->count ? key_index + 1 : (current->loop ? 0 : key_index);
+    const anim_key_t *to = &current->keys[next];
+    int32_t t = elapsed_ms < key->ms ? (int32_t)elapsed_ms : key->ms;
+    r = key->r + ((int32_t)to->r - key->r) * t / key->ms;
+    g = key->g + ((int32_t)to->g - key->g) * t / key->ms;
+    b = key->b + ((int32_t)to->b - key->b) * t / key->ms;
+  }
+
+  matrix_clear(anim_layer);
+  for (uint8_t y = 0; y < MATRIX_HEIGHT; ++y)
+    for (uint8_t x = 0; x < MATRIX_WIDTH; ++x)
+      if (key->mask & ANIM_PIXEL(x, y))
+        matrix_set(anim_layer, x, y, r, g, b);
+  anim_present();
+  dirty = false;
+}
+
+static void anim_enter(uint8_t index) {
+  key_index = index;
+  dirty = true;
+  if (current->keys[index].flags & ANIM_CUE)
+    sched_post(anim_event, index);
+}
+
+static void anim_step(void) {
+  elapsed_ms += ANIM_FRAME_US / 1000;
+
+  // Quadros-chave de 0 ms são atravessados na mesma volta (ex.: o alvo de uma
+  // interpolação no fim), mas no máximo uma passada pela tabela por quadro
+  for (uint8_t n = 0; n < current->count && elapsed_ms >= current->keys[key_index].ms; ++n) {
+    elapsed_ms -= current->keys[key_index].ms;
+    uint8_t next = key_index + 1;
+    if (next >= current->count) {
+      if (!current->loop) {
+        // Fim: o último quadro-chave fica na matriz
+        elapsed_ms = current->keys[key_index].ms;
+        anim_draw();
+        anim_stop();
+        sched_post(anim_event, ANIM_DONE);
+        return;
+      }
+      next = 0;
+    }
+    anim_enter(next);
+  }
+
+  if (dirty || (current->keys[key_index].flags & ANIM_TWEEN))
+    anim_draw();
+}
+
+static void anim_handle(const sched_event_t *ev) {
+  if (ev->id == ANIM_EV_FRAME && current)
+    anim_step();
+}
+
+// A animação desenha sozinha na camada `layer` e chama `present` para
+// compor e enviar o quadro; cues e o fim são postados como `event`
+void anim_init(uint8_t layer, uint16_t event, void (*present)(void)) {
+  anim_layer = layer;
+  anim_event = event;
+  anim_present = present;
+  current = NULL;
+  sched_add_handler(anim_handle);
+}
+
+// Começa `anim` do início, substituindo a que estiver tocando
+void anim_play(const anim_t *anim) {
+  // Em laço, uma volta sem duração nunca deixaria o tempo andar
+  uint32_t total_ms = 0;
+  for (uint8_t i = 0; i < anim->count; ++i)
+    total_ms += anim->keys[i].ms;
+  hard_assert(anim->count > 0 && (!anim->loop || total_ms > 0));
+
+  anim_stop();
+  current = anim;
+  elapsed_ms = 0;
+  anim_enter(0);
+  anim_draw();
+  sched_timer_start(&frame_timer, ANIM_EV_FRAME, ANIM_FRAME_US, true);
+}
+
+// Interrompe sem apagar a camada (quadros já postados são descartados)
+void anim_stop(void) {
+  sched_timer_stop(&frame_timer);
+  current = NULL;
+}
+
+bool anim_playing(void) {
+  return current != NULL;
+}
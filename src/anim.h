@@ -0,0 +1,43 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include "pico/stdlib.h"
+#include "matrix.h"
+
+#define ANIM_FRAME_US 20000 // 50 quadros por segundo
+#define ANIM_EV_FRAME 0xFF10 // Id interno do temporizador de quadros
+
+// Máscaras de LEDs em coordenadas lógicas (bit y * 5 + x, y para cima)
+#define ANIM_PIXEL(x, y) (1u << ((y) * MATRIX_WIDTH + (x)))
+#define ANIM_ROW(y) (0x1Fu << ((y) * MATRIX_WIDTH))
+#define ANIM_ALL ((1u << MATRIX_LEDS) - 1)
+
+// Flags de um quadro-chave
+#define ANIM_TWEEN 0x01 // Interpola a cor até a do próximo quadro-chave
+#define ANIM_CUE 0x02   // Posta o evento da animação (arg = índice) ao entrar
+
+#define ANIM_DONE 0xFFFF // `arg` do evento quando a animação termina
+
+typedef struct {
+  uint32_t mask;
+  uint8_t r, g, b;
+  uint8_t flags;
+  uint16_t ms; // Duração do quadro-chave
+} anim_key_t;
+
+typedef struct {
+  const anim_key_t *keys;
+  uint8_t count;
+  bool loop;
+} anim_t;
+
+#define ANIM_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+#define ANIM_ONCE(keys) { (keys), ANIM_COUNT(keys), false }
+#define ANIM_LOOP(keys) { (keys), ANIM_COUNT(keys), true }
+
+void anim_init(uint8_t layer, uint16_t event, void (*present)(void));
+void anim_play(const anim_t *anim);
+void anim_stop(void);
+bool anim_playing(void);
+
+#endif
@@ -1,35 +1,114 @@
 #include "buzzer.h"
+#include "hardware/sync.h"
+#include "perf.h"
 
-#define BUZZER_FREQ 4000
+// Sequenciador não bloqueante: cada nota programa divisor/wrap do PWM para a
+// frequência pedida (duty de 50%) e um alarme troca para a próxima nota.
+// O alarm pool é criado no núcleo que chama pwm_init_buzzer(), então as
+// trocas de nota rodam no mesmo núcleo que é dono do buzzer.
+
+#define BUZZER_MAX_ALARMS 2
+
+static uint buzzer_pin;
+static uint buzzer_slice;
+static alarm_pool_t *buzzer_pool;
+static alarm_id_t buzzer_alarm;
+static const buzzer_melody_t *melody;
+static uint8_t note_index;
+static uint8_t plays_left;
+
+static void buzzer_set_freq(uint16_t freq_hz) {
+    if (freq_hz == 0) {
+        pwm_set_gpio_level(buzzer_pin, 0);
+        return;
+    }
+
+    // Divisor em 1/16 (8.4 bits) grande o suficiente para o wrap caber em 16 bits
+    uint32_t clock = clock_get_hz(clk_sys);
+    uint32_t div16 = (uint32_t)(((uint64_t)clock * 16 + (uint64_t)freq_hz * 65536 - 1) / ((uint64_t)freq_hz * 65536));
+    if (div16 < 16)
+        div16 = 16;
+    if (div16 > 0xFFF)
+        div16 = 0xFFF;
+    uint32_t wrap = (uint32_t)((uint64_t)clock * 16 / (div16 * freq_hz)) - 1;
+    if (wrap > 0xFFFF)
+        wrap = 0xFFFF;
+
+    pwm_set_clkdiv_int_frac(buzzer_slice, div16 >> 4, div16 & 0xF);
+    pwm_set_wrap(buzzer_slice, wrap);
+    pwm_set_gpio_level(buzzer_pin, (wrap + 1) / 2);
+}
+
+// Toca a nota atual e devolve a sua duração em µs. Uma nota de 0 ms vira um
+// passo de 1 µs: o callback retornando 0 não reagendaria o alarme e a
+// melodia nunca terminaria.
+static uint32_t buzzer_start_note(void) {
+    const buzzer_note_t *note = &melody->notes[note_index];
+    buzzer_set_freq(note->freq_hz);
+    return note->ms ? note->ms * 1000u : 1;
+}
+
+static int64_t buzzer_next_note(alarm_id_t id, void *user_data) {
+    if (!melody)
+        return 0;
+
+    if (++note_index >= melody->count) {
+        note_index = 0;
+        if (--plays_left == 0) {
+            pwm_set_gpio_level(buzzer_pin, 0);
+            melody = NULL;
+            buzzer_alarm = 0;
+            return 0;
+        }
+    }
+    // Reagenda a partir do disparo anterior: a melodia não acumula atraso
+    return buzzer_start_note();
+}
 
 void pwm_init_buzzer(uint pin) {
     // Configurar o pino como saída de PWM
     gpio_set_function(pin, GPIO_FUNC_PWM);
 
     // Obter o slice do PWM associado ao pino
-    uint slice_num = pwm_gpio_to_slice_num(pin);
+    buzzer_pin = pin;
+    buzzer_slice = pwm_gpio_to_slice_num(pin);
 
-    // Configurar o PWM com frequência desejada
     pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, clock_get_hz(clk_sys) / (BUZZER_FREQ * 4096)); // Divisor de clock
-    pwm_init(slice_num, &config, true);
+    pwm_init(buzzer_slice, &config, true);
 
     // Iniciar o PWM no nível baixo
     pwm_set_gpio_level(pin, 0);
-}
 
-void beep(uint pin, uint duration_ms) {
-    uint slice_num = pwm_gpio_to_slice_num(pin);
+    buzzer_pool = alarm_pool_create_with_unused_hardware_alarm(BUZZER_MAX_ALARMS);
+}
 
-    // Configurar o duty cycle para 50% (ativo)
-    pwm_set_gpio_level(pin, 2048);
+// Começa a melodia e retorna na hora, substituindo a que estiver tocando
+void buzzer_play(const buzzer_melody_t *m) {
+    PERF_BEGIN();
+    uint32_t status = save_and_disable_interrupts();
+    if (buzzer_alarm > 0)
+        alarm_pool_cancel_alarm(buzzer_pool, buzzer_alarm);
+    buzzer_alarm = 0;
 
-    // Temporização
-    sleep_ms(duration_ms);
+    melody = m;
+    note_index = 0;
+    plays_left = m->repeat ? m->repeat : 1;
+    uint32_t us = buzzer_start_note();
+    buzzer_alarm = alarm_pool_add_alarm_in_us(buzzer_pool, us, buzzer_next_note, NULL, true);
+    restore_interrupts(status);
+    PERF_END(PERF_BUZZER);
+}
 
-    // Desativar o sinal PWM (duty cycle 0)
-    pwm_set_gpio_level(pin, 0);
+void buzzer_stop(void) {
+    uint32_t status = save_and_disable_interrupts();
+    if (buzzer_alarm > 0)
+        alarm_pool_cancel_alarm(buzzer_pool, buzzer_alarm);
+    buzzer_alarm = 0;
+    melody = NULL;
+    pwm_set_gpio_level(buzzer_pin, 0);
+    restore_interrupts(status);
+}
 
-    // Pausa entre os beeps
-    sleep_ms(100); // Pausa de 100ms
-}
\ No newline at end of file
+bool buzzer_playing(void) {
+    return melody != NULL;
+}
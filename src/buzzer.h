@@ -5,7 +5,24 @@
 #include "hardware/pwm.h"
 #include "hardware/clocks.h"
 
+// Nota de uma melodia; freq_hz = 0 é uma pausa
+typedef struct {
+  uint16_t freq_hz;
+  uint16_t ms;
+} buzzer_note_t;
+
+typedef struct {
+  const buzzer_note_t *notes;
+  uint8_t count;
+  uint8_t repeat; // Quantas vezes a sequência toca (mínimo 1)
+} buzzer_melody_t;
+
+#define BUZZER_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+#define BUZZER_MELODY(notes, repeat) { (notes), BUZZER_COUNT(notes), (repeat) }
+
 void pwm_init_buzzer(uint pin);
-void beep(uint pin, uint duration_ms);
+void buzzer_play(const buzzer_melody_t *melody);
+void buzzer_stop(void);
+bool buzzer_playing(void);
 
-#endif
\ No newline at end of file
+#endif
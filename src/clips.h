@@ -0,0 +1,444 @@
+#ifndef CLIPS_H
+#define CLIPS_H
+
+#include "pcm.h"
+
+// Clipes PCM de 8 bits sem sinal (128 = silêncio) a PCM_SAMPLE_RATE, na flash
+
+// Carrilhão: E6 + B6 com decaimento, 0,6 s
+static const uint8_t clip_chime_samples[] = {
+  128, 129, 130, 126, 125, 127, 128, 129, 133, 134, 122, 113, 125, 144, 141, 122,
+  115, 123, 128, 130, 140, 143, 120,  98, 116, 155, 156, 122, 104, 118, 129, 130,
+  144, 153, 122,  84, 103, 161, 174, 126,  94, 110, 128, 130, 145, 159, 129,  81,
+   93, 156, 179, 134,  95, 107, 128, 130, 141, 158, 136,  86,  87, 147, 180, 142,
+   98, 103, 126, 131, 138, 157, 142,  93,  83, 138, 180, 150, 101, 100, 124, 131,
+  136, 154, 147,  99,  80, 128, 178, 157, 106,  97, 121, 131, 134, 152, 150, 107,
+   79, 119, 174, 164, 112,  95, 118, 132, 133, 149, 153, 114,  79, 110, 169, 170,
+  119,  94, 114, 131, 133, 146, 154, 121,  82, 103, 162, 174, 126,  94, 111, 131,
+  133, 143, 154, 128,  85,  96, 155, 177, 134,  95, 107, 130, 133, 140, 154, 134,
+   90,  90, 146, 178, 141,  98, 103, 128, 133, 138, 152, 139,  96,  86, 138, 177,
+  149, 101, 100, 125, 134, 136, 150, 144, 102,  84, 129, 175, 156, 106,  97, 122,
+  134, 135, 148, 147, 108,  83, 120, 172, 162, 112,  95, 119, 134, 135, 146, 149,
+  115,  84, 112, 167, 168, 118,  94, 115, 134, 134, 143, 150, 121,  86, 105, 161,
+  172, 125,  94, 111, 133, 135, 141, 150, 127,  89,  99, 153, 174, 133,  95, 107,
+  132, 135, 139, 150, 133,  93,  94, 146, 175, 140,  98, 103, 129, 136, 137, 148,
+  137,  98,  90, 137, 175, 148, 101, 100, 127, 136, 136, 147, 141, 104,  88, 129,
+  173, 154, 106,  97, 123, 137, 136, 145, 144, 110,  87, 121, 169, 161, 112,  95,
+  120, 137, 136, 143, 145, 116,  88, 114, 165, 166, 118,  94, 116, 136, 136, 141,
+  146, 122,  90, 107, 159, 169, 125,  94, 111, 135, 136, 139, 146, 127,  93, 101,
+  152, 172, 132,  95, 107, 133, 137, 138, 146, 131,  97,  97, 145, 173, 139,  98,
+  103, 131, 138, 137, 145, 135, 101,  93, 137, 172, 146, 101, 100, 128, 138, 136,
+  143, 138, 106,  92, 129, 170, 153, 106,  97, 124, 139, 136, 142, 141, 112,  91,
+  122, 167, 159, 112,  95, 120, 138, 137, 140, 142, 117,  92, 115, 163, 163, 118,
+   94, 116, 138, 137, 139, 143, 122,  93, 109, 157, 167, 125,  95, 112, 136, 138,
+  138, 143, 126,  96, 104, 151, 169, 132,  96, 108, 134, 139, 137, 142, 130, 100,
+  100, 144, 170, 139,  98, 104, 132, 140, 136, 141, 134, 104,  97, 137, 170, 145,
+  102, 100, 129, 140, 136, 140, 136, 108,  95, 130, 168, 151, 106,  98, 125, 140,
+  137, 139, 138, 113,  95, 123, 165, 157, 112,  96, 121, 140, 137, 138, 139, 118,
+   95, 117, 160, 161, 118,  95, 117, 139, 138, 137, 140, 122,  97, 111, 155, 165,
+  124,  95, 112, 138, 139, 136, 140, 126,  99, 106, 149, 167, 131,  97, 108, 136,
+  140, 136, 139, 129, 103, 103, 143, 168, 138,  99, 104, 133, 141, 136, 138, 132,
+  106, 100, 136, 167, 144, 102, 101, 129, 142, 136, 138, 134, 110,  98, 130, 165,
+  150, 107,  98, 126, 142, 137, 137, 136, 114,  98, 124, 162, 155, 112,  97, 121,
+  141, 138, 136, 137, 118,  99, 118, 158, 159, 118,  96, 117, 140, 139, 135, 137,
+  122, 100, 113, 153, 162, 124,  96, 113, 139, 140, 135, 137, 125, 102, 109, 148,
+  164, 131,  97, 109, 136, 141, 135, 136, 128, 105, 105, 142, 165, 137, 100, 105,
+  134, 142, 135, 136, 131, 109, 103, 136, 164, 143, 103, 102, 130, 143, 136, 135,
+  132, 112, 102, 130, 163, 149, 107,  99, 126, 143, 137, 134, 133, 116, 101, 124,
+  160, 153, 113,  97, 122, 142, 139, 134, 134, 119, 102, 119, 156, 157, 118,  97,
+  118, 141, 140, 134, 134, 122, 103, 115, 152, 160, 124,  97, 113, 140, 141, 134,
+  134, 125, 105, 111, 147, 162, 130,  98, 109, 137, 142, 134, 134, 127, 108, 108,
+  141, 162, 136, 101, 106, 134, 143, 135, 133, 129, 111, 106, 136, 162, 142, 104,
+  102, 131, 144, 136, 133, 131, 114, 105, 130, 160, 147, 108, 100, 127, 144, 137,
+  132, 131, 117, 104, 125, 158, 152, 113,  98, 123, 143, 139, 132, 132, 120, 105,
+  120, 154, 155, 118,  98, 118, 142, 140, 132, 132, 122, 106, 116, 150, 158, 124,
+   98, 114, 140, 142, 133, 132, 125, 108, 113, 145, 159, 130,  99, 110, 138, 143,
+  134, 132, 127, 110, 110, 140, 160, 135, 102, 106, 135, 144, 135, 131, 128, 113,
+  108, 135, 159, 141, 105, 103, 131, 145, 136, 131, 129, 115, 107, 130, 158, 146,
+  109, 101, 127, 144, 137, 131, 130, 118, 107, 126, 155, 150, 113,  99, 123, 144,
+  139, 131, 130, 120, 108, 121, 152, 153, 119,  99, 119, 143, 141, 131, 130, 123,
+  109, 118, 148, 156, 124,  99, 115, 141, 142, 132, 130, 124, 110, 115, 144, 157,
+  129, 100, 111, 138, 144, 133, 129, 126, 112, 112, 140, 158, 135, 103, 107, 135,
+  145, 134, 129, 127, 115, 111, 135, 157, 140, 106, 104, 132, 145, 136, 129, 128,
+  117, 110, 130, 156, 144, 110, 102, 128, 145, 137, 129, 128, 119, 110, 126, 153,
+  148, 114, 101, 123, 144, 139, 129, 128, 121, 110, 122, 150, 151, 119, 100, 119,
+  143, 141, 130, 128, 123, 111, 119, 147, 154, 124, 100, 115, 141, 143, 131, 128,
+  124, 113, 117, 143, 155, 129, 102, 111, 138, 144, 132, 128, 125, 115, 115, 139,
+  155, 134, 104, 108, 135, 145, 134, 127, 126, 116, 113, 135, 155, 139, 107, 105,
+  132, 145, 136, 127, 127, 118, 113, 131, 153, 143, 110, 103, 128, 145, 137, 128,
+  127, 120, 112, 127, 151, 147, 115, 102, 124, 145, 139, 128, 127, 122, 113, 123,
+  148, 149, 119, 101, 120, 143, 141, 129, 126, 123, 114, 121, 145, 151, 124, 102,
+  116, 141, 143, 130, 126, 124, 115, 118, 142, 153, 129, 103, 112, 139, 144, 132,
+  126, 125, 116, 116, 138, 153, 133, 105, 109, 136, 145, 133, 126, 125, 118, 115,
+  134, 152, 138, 108, 106, 132, 146, 135, 126, 125, 119, 115, 131, 151, 142, 111,
+  104, 128, 145, 137, 127, 125, 121, 115, 127, 149, 145, 115, 103, 124, 145, 139,
+  127, 125, 122, 115, 124, 147, 148, 120, 103, 120, 143, 141, 128, 125, 123, 116,
+  122, 144, 150, 124, 103, 117, 141, 143, 130, 125, 124, 117, 120, 141, 151, 129,
+  104, 113, 139, 144, 131, 125, 124, 118, 118, 137, 151, 133, 106, 110, 136, 145,
+  133, 125, 125, 119, 117, 134, 150, 137, 109, 107, 132, 146, 135, 125, 125, 121,
+  117, 131, 149, 141, 112, 105, 129, 145, 137, 125, 124, 122, 117, 128, 147, 144,
+  116, 104, 125, 145, 139, 126, 124, 123, 117, 125, 145, 146, 120, 104, 121, 143,
+  141, 128, 124, 123, 118, 123, 142, 148, 124, 104, 117, 141, 143, 129, 124, 124,
+  119, 121, 139, 149, 128, 105, 114, 139, 144, 131, 123, 124, 120, 120, 136, 149,
+  132, 107, 111, 136, 145, 133, 124, 124, 121, 119, 134, 148, 136, 110, 108, 132,
+  145, 135, 124, 124, 122, 119, 131, 147, 139, 113, 107, 129, 145, 137, 125, 123,
+  123, 119, 128, 146, 142, 117, 106, 125, 144, 139, 126, 123, 123, 119, 126, 143,
+  144, 120, 105, 121, 143, 141, 127, 123, 124, 120, 124, 141, 146, 124, 106, 118,
+  141, 143, 128, 123, 124, 120, 122, 138, 147, 128, 107, 115, 139, 144, 130, 122,
+  124, 121, 121, 136, 147, 132, 109, 112, 136, 145, 132, 123, 123, 122, 121, 133,
+  146, 135, 111, 109, 132, 145, 135, 123, 123, 123, 121, 131, 145, 138, 114, 108,
+  129, 145, 137, 124, 123, 123, 121, 128, 144, 141, 117, 107, 125, 144, 139, 125,
+  122, 124, 121, 126, 142, 143, 121, 107, 122, 143, 141, 126, 122, 124, 121, 125,
+  140, 144, 124, 107, 118, 141, 143, 128, 122, 124, 122, 124, 137, 145, 128, 108,
+  115, 138, 144, 130, 122, 123, 123, 123, 135, 145, 131, 110, 113, 136, 145, 132,
+  122, 123, 123, 122, 133, 144, 134, 112, 111, 132, 145, 134, 122, 123, 124, 122,
+  131, 144, 137, 115, 109, 129, 145, 137, 123, 122, 124, 122, 129, 142, 139, 118,
+  108, 126, 144, 139, 124, 122, 124, 122, 127, 141, 141, 121, 108, 122, 142, 141,
+  126, 121, 124, 123, 126, 139, 142, 124, 108, 119, 141, 142, 128, 121, 124, 123,
+  125, 137, 143, 128, 109, 116, 138, 143, 130, 121, 123, 124, 124, 134, 143, 131,
+  111, 114, 135, 144, 132, 121, 123, 124, 124, 133, 143, 134, 113, 112, 132, 145,
+  134, 122, 122, 124, 124, 131, 142, 136, 116, 110, 129, 144, 136, 123, 121, 124,
+  124, 129, 141, 138, 118, 109, 126, 143, 138, 124, 121, 124, 124, 128, 139, 140,
+  121, 109, 123, 142, 140, 125, 121, 124, 124, 127, 137, 141, 125, 110, 120, 140,
+  142, 127, 120, 124, 125, 126, 136, 141, 128, 111, 117, 138, 143, 129, 120, 123,
+  125, 125, 134, 141, 130, 112, 115, 135, 144, 132, 121, 122, 125, 125, 132, 141,
+  133, 114, 113, 132, 144, 134, 121, 122, 125, 125, 131, 140, 135, 116, 111, 129,
+  144, 136, 122, 121, 125, 125, 129, 139, 137, 119, 111, 126, 143, 138, 124, 120,
+  125, 125, 128, 138, 138, 122, 110, 123, 142, 140, 125, 120, 124, 125, 127, 136,
+  139, 125, 111, 120, 140, 141, 127, 120, 124, 126, 127, 135, 140, 127, 112, 118,
+  138, 143, 129, 120, 123, 126, 126, 133, 140, 130, 113, 116, 135, 143, 131, 120,
+  122, 126, 126, 132, 140, 132, 115, 114, 132, 144, 133, 121, 121, 126, 126, 131,
+  139, 134, 117, 113, 129, 143, 136, 122, 121, 126, 126, 129, 138, 136, 120, 112,
+  126, 142, 138, 123, 120, 125, 126, 129, 137, 137, 122, 112, 124, 141, 139, 125,
+  120, 124, 127, 128, 135, 138, 125, 112, 121, 139, 141, 127, 119, 124, 127, 127,
+  134, 138, 127, 113, 118, 137, 142, 129, 120, 123, 127, 127, 133, 138, 130, 114,
+  116, 135, 143, 131, 120, 122, 127, 127, 132, 138, 132, 116, 115, 132, 143, 133,
+  121, 121, 126, 127, 131, 137, 134, 118, 114, 129, 143, 135, 122, 120, 126, 127,
+  130, 137, 135, 120, 113, 127, 142, 137, 123, 120, 125, 127, 129, 136, 136, 123,
+  113, 124, 141, 139, 125, 119, 125, 128, 128, 135, 137, 125, 113, 121, 139, 140,
+  127, 119, 124, 128, 128, 133, 137, 127, 114, 119, 137, 142, 129, 119, 123, 127,
+  128, 132, 137, 129, 115, 117, 135, 142, 131, 120, 122, 127, 128, 131, 137, 131,
+  117, 116, 132, 142, 133, 120, 121, 127, 128, 131, 136, 133, 119, 115, 129, 142,
+  135, 122, 120, 126, 128, 130, 135, 134, 121, 114, 127, 141, 137, 123, 120, 126,
+  128, 129, 135, 135, 123, 114, 124, 140, 139, 125, 119, 125, 128, 129, 134, 136,
+  125, 115, 122, 138, 140, 126, 119, 124, 128, 129, 133, 136, 127, 115, 120, 137,
+  141, 128, 119, 123, 128, 129, 132, 136, 129, 116, 118, 134, 142, 131, 120, 122,
+  128, 129, 131, 136, 131, 118, 117, 132, 142, 133, 120, 121, 127, 129, 130, 135,
+  132, 120, 116, 130, 141, 135, 121, 120, 127, 129, 130, 134, 133, 121, 115, 127,
+  141, 136, 123, 120, 126, 129, 130, 134, 134, 123, 115, 125, 139, 138, 124, 119,
+  125, 129, 129, 133, 134, 125, 116, 123, 138, 139, 126, 119, 124, 129, 129, 132,
+  135, 127, 116, 121, 136, 140, 128, 119, 123, 129, 129, 131, 135, 129, 117, 119,
+  134, 141, 130, 120, 122, 128, 129, 131, 134, 130, 119, 118, 132, 141, 132, 120,
+  121, 128, 130, 130, 134, 131, 120, 117, 130, 141, 134, 121, 120, 127, 130, 130,
+  133, 132, 122, 116, 127, 140, 136, 123, 120, 126, 130, 130, 133, 133, 124, 116,
+  125, 139, 138, 124, 119, 125, 130, 130, 132, 133, 125, 117, 123, 137, 139, 126,
+  119, 124, 130, 130, 132, 134, 127, 117, 121, 136, 140, 128, 119, 123, 129, 130,
+  131, 134, 128, 118, 120, 134, 140, 130, 120, 122, 129, 130, 131, 133, 130, 120,
+  119, 132, 140, 132, 120, 121, 128, 130, 130, 133, 131, 121, 118, 130, 140, 134,
+  121, 120, 127, 130, 130, 133, 132, 122, 118, 127, 139, 136, 123, 120, 126, 130,
+  130, 132, 132, 124, 117, 125, 138, 137, 124, 119, 125, 130, 130, 132, 133, 126,
+  118, 124, 137, 138, 126, 119, 124, 130, 130, 131, 133, 127, 118, 122, 135, 139,
+  128, 119, 123, 130, 130, 131, 133, 128, 119, 121, 133, 140, 130, 120, 122, 129,
+  131, 130, 132, 129, 120, 120, 131, 140, 132, 120, 121, 128, 131, 130, 132, 130,
+  122, 119, 130, 139, 134, 122, 120, 128, 131, 130, 132, 131, 123, 118, 128, 139,
+  135, 123, 120, 127, 131, 130, 131, 131, 124, 118, 126, 138, 137, 124, 119, 126,
+  131, 130, 131, 132, 126, 119, 124, 136, 138, 126, 119, 124, 131, 131, 131, 132,
+  127, 119, 122, 135, 138, 128, 119, 123, 130, 131, 130, 132, 128, 120, 121, 133,
+  139, 130, 120, 122, 129, 131, 130, 132, 129, 121, 120, 131, 139, 132, 121, 121,
+  129, 131, 130, 131, 130, 122, 120, 129, 139, 133, 122, 120, 128, 131, 130, 131,
+  130, 123, 119, 128, 138, 135, 123, 120, 127, 131, 130, 131, 131, 125, 119, 126,
+  137, 136, 124, 119, 126, 131, 131, 130, 131, 126, 120, 124, 136, 137, 126, 119,
+  125, 131, 131, 130, 131, 127, 120, 123, 134, 138, 128, 120, 123, 130, 131, 130,
+  131, 128, 121, 122, 133, 138, 130, 120, 122, 130, 131, 130, 131, 129, 122, 121,
+  131, 138, 131, 121, 121, 129, 132, 130, 130, 129, 123, 121, 129, 138, 133, 122,
+  121, 128, 132, 130, 130, 130, 124, 120, 128, 137, 134, 123, 120, 127, 132, 131,
+  130, 130, 125, 120, 126, 136, 136, 125, 120, 126, 131, 131, 130, 130, 126, 121,
+  125, 135, 137, 126, 120, 125, 131, 131, 130, 130, 127, 121, 124, 134, 137, 128,
+  120, 124, 131, 131, 130, 130, 128, 122, 123, 133, 138, 129, 120, 122, 130, 132,
+  130, 130, 128, 123, 122, 131, 138, 131, 121, 122, 129, 132, 130, 130, 129, 123,
+  121, 129, 137, 133, 122, 121, 128, 132, 130, 130, 129, 124, 121, 128, 137, 134,
+  123, 120, 127, 132, 131, 130, 129, 125, 121, 126, 136, 135, 125, 120, 126, 132,
+  131, 129, 130, 126, 121, 125, 135, 136, 126, 120, 125, 131, 131, 129, 130, 127,
+  122, 124, 134, 137, 128, 120, 124, 131, 132, 130, 129, 127, 122, 123, 132, 137,
+  129, 120, 123, 130, 132, 130, 129, 128, 123, 123, 131, 137, 131, 121, 122, 129,
+  132, 130, 129, 128, 124, 122, 129, 137, 132, 122, 121, 128, 132, 130, 129, 129,
+  125, 122, 128, 136, 133, 123, 120, 127, 132, 131, 129, 129, 125, 122, 127, 135,
+  135, 125, 120, 126, 132, 131, 129, 129, 126, 122, 126, 134, 135, 126, 120, 125,
+  132, 131, 129, 129, 127, 123, 125, 133, 136, 128, 120, 124, 131, 132, 129, 129,
+  127, 123, 124, 132, 136, 129, 121, 123, 130, 132, 130, 129, 128, 124, 123, 131,
+  136, 131, 121, 122, 129, 132, 130, 129, 128, 124, 123, 129, 136, 132, 122, 121,
+  128, 132, 130, 129, 128, 125, 123, 128, 135, 133, 124, 121, 127, 132, 131, 129,
+  128, 126, 123, 127, 135, 134, 125, 120, 126, 132, 131, 129, 128, 126, 123, 126,
+  134, 135, 126, 120, 125, 132, 132, 129, 128, 127, 123, 125, 133, 135, 128, 121,
+  124, 131, 132, 129, 128, 127, 124, 124, 132, 136, 129, 121, 123, 130, 132, 129,
+  128, 128, 124, 124, 130, 136, 130, 122, 122, 129, 132, 130, 128, 128, 125, 124,
+  129, 135, 132, 123, 121, 129, 133, 130, 128, 128, 125, 123, 128, 135, 133, 124,
+  121, 127, 132, 131, 128, 128, 126, 123, 127, 134, 134, 125, 121, 126, 132, 131,
+  128, 128, 126, 124, 126, 133, 134, 126, 121, 125, 132, 132, 129, 128, 127, 124,
+  125, 132, 135, 128, 121, 124, 131, 132, 129, 128, 127, 124, 125, 131, 135, 129,
+  121, 123, 130, 132, 129, 128, 127, 125, 124, 130, 135, 130, 122, 122, 130, 133,
+  130, 128, 128, 125, 124, 129, 135, 131, 123, 122, 129, 133, 130, 128, 128, 126,
+  124, 128, 134, 132, 124, 121, 128, 132, 131, 128, 128, 126, 124, 127, 134, 133,
+  125, 121, 126, 132, 131, 128, 128, 127, 124, 126, 133, 134, 126, 121, 125, 132,
+  132, 128, 127, 127, 125, 126, 132, 134, 128, 121, 124, 131, 132, 129, 127, 127,
+  125, 125, 131, 134, 129, 122, 123, 130, 132, 129, 127, 127, 125, 125, 130, 134,
+  130, 122, 123, 130, 133, 130, 127, 127, 126, 125, 129, 134, 131, 123, 122, 129,
+  133, 130, 127, 127, 126, 125, 128, 134, 132, 124, 122, 128, 133, 131, 128, 127,
+  126, 125, 127, 133, 133, 125, 121, 127, 132, 131, 128, 127, 127, 125, 127, 133,
+  133, 126, 121, 126, 132, 132, 128, 127, 127, 125, 126, 132, 134, 127, 122, 125,
+  131, 132, 129, 127, 127, 125, 126, 131, 134, 129, 122, 124, 130, 132, 129, 127,
+  127, 126, 125, 130, 134, 130, 123, 123, 130, 133, 130, 127, 127, 126, 125, 129,
+  134, 131, 123, 122, 129, 133, 130, 127, 127, 126, 125, 128, 133, 132, 124, 122,
+  128, 133, 131, 127, 127, 127, 125, 128, 133, 132, 125, 122, 127, 132, 131, 128,
+  127, 127, 125, 127, 132, 133, 126, 122, 126, 132, 132, 128, 127, 127, 126, 127,
+  131, 133, 127, 122, 125, 131, 132, 128, 127, 127, 126, 126, 131, 133, 129, 122,
+  124, 130, 132, 129, 127, 127, 126, 126, 130, 133, 130, 123, 123, 130, 133, 129,
+  127, 127, 126, 126, 129, 133, 130, 124, 123, 129, 133, 130, 127, 127, 126, 126,
+  128, 133, 131, 124, 122, 128, 132, 131, 127, 127, 127, 126, 128, 132, 132, 125,
+  122, 127, 132, 131, 127, 127, 127, 126, 127, 132, 132, 126, 122, 126, 132, 132,
+  128, 127, 127, 126, 127, 131, 133, 127, 122, 125, 131, 132, 128, 126, 127, 126,
+  126, 130, 133, 128, 123, 124, 130, 132, 129, 126, 127, 126, 126, 130, 133, 129,
+  123, 123, 130, 132, 129, 127, 127, 127, 126, 129, 133, 130, 124, 123, 129, 133,
+  130, 127, 127, 127, 126, 128, 132, 131, 125, 123, 128, 132, 131, 127, 127, 127,
+  126, 128, 132, 132, 126, 122, 127, 132, 131, 127, 126, 127, 126, 127, 131, 132,
+  127, 122, 126, 132, 132, 128, 126, 127, 126, 127, 131, 132, 127, 123, 125, 131,
+  132, 128, 126, 127, 127, 127, 130, 132, 128, 123, 124, 130, 132, 129, 126, 127,
+  127, 127, 130, 132, 129, 124, 124, 130, 132, 129, 126, 127, 127, 127, 129, 132,
+  130, 124, 123, 129, 132, 130, 127, 126, 127, 127, 128, 132, 131, 125, 123, 128,
+  132, 130, 127, 126, 127, 127, 128, 131, 131, 126, 123, 127, 132, 131, 127, 126,
+  127, 127, 128, 131, 132, 127, 123, 126, 132, 131, 128, 126, 127, 127, 127, 130,
+  132, 127, 123, 125, 131, 132, 128, 126, 127, 127, 127, 130, 132, 128, 123, 125,
+  130, 132, 129, 126, 127, 127, 127, 129, 132, 129, 124, 124, 130, 132, 129, 126,
+  127, 127, 127, 129, 132, 130, 124, 124, 129, 132, 130, 126, 126, 127, 127, 129,
+  131, 130, 125, 123, 128, 132, 130, 127, 126, 127, 127, 128, 131, 131, 126, 123,
+  127, 132, 131, 127, 126, 127, 127, 128, 131, 131, 127, 123, 126, 131, 131, 128,
+  126, 127, 127, 128, 130, 131, 127, 123, 126, 131, 132, 128, 126, 127, 127, 127,
+  130, 131, 128, 124, 125, 130, 132, 129, 126, 127, 127, 127, 129, 131, 129, 124,
+  124, 130, 132, 129, 126, 126, 127, 127, 129, 131, 130, 125, 124, 129, 132, 130,
+  126, 126, 127, 127, 129, 131, 130, 125, 124, 128, 132, 130, 127, 126, 127, 127,
+  128, 131, 131, 126, 123, 127, 132, 131, 127, 126, 127, 127, 128, 130, 131, 127,
+  123, 126, 131, 131, 127, 126, 127, 127, 128, 130, 131, 127, 124, 126, 131, 132,
+  128, 126, 127, 127, 128, 130, 131, 128, 124, 125, 130, 132, 129, 126, 127, 127,
+  128, 129, 131, 129, 124, 125, 130, 132, 129, 126, 126, 127, 128, 129, 131, 129,
+  125, 124, 129, 132, 130, 126, 126, 127, 128, 129, 131, 130, 125, 124, 128, 132,
+  130, 127, 126, 127, 128, 128, 130, 130, 126, 124, 127, 132, 131, 127, 126, 127,
+  128, 128, 130, 130, 127, 124, 127, 131, 131, 127, 126, 127, 128, 128, 130, 131,
+  127, 124, 126, 131, 132, 128, 126, 127, 128, 128, 129, 131, 128, 124, 125, 130,
+  132, 128, 126, 127, 128, 128, 129, 131, 129, 125, 125, 129, 132, 129, 126, 126,
+  128, 128, 129, 131, 129, 125, 124, 129, 132, 130, 126, 126, 128, 128, 129, 130,
+  130, 126, 124, 128, 132, 130, 126, 126, 127, 128, 128, 130, 130, 126, 124, 127,
+  131, 131, 127, 126, 127, 128, 128, 130, 130, 127, 124, 127, 131, 131, 127, 126,
+  127, 128, 128, 130, 130, 127, 124, 126, 131, 131, 128, 126, 127, 128, 128, 129,
+  130, 128, 125, 125, 130, 132, 128, 126, 127, 128, 128, 129, 130, 129, 125, 125,
+  129, 132, 129, 126, 126, 128, 128, 129, 130, 129, 125, 125, 129, 132, 130, 126,
+  126, 128, 128, 129, 130, 129, 126, 125, 128, 132, 130, 126, 126, 128, 128, 128,
+  130, 130, 126, 124, 127, 131, 131, 127, 126, 127, 128, 128, 130, 130, 127, 124,
+  127, 131, 131, 127, 126, 127, 128, 128, 129, 130, 127, 125, 126, 131, 131, 128,
+  126, 127, 128, 128, 129, 130, 128, 125, 126, 130, 131, 128, 126, 127, 128, 128,
+  129, 130, 128, 125, 125, 129, 132, 129, 126, 126, 128, 128, 129, 130, 129, 126,
+  125, 129, 132, 129, 126, 126, 128, 128, 129, 130, 129, 126, 125, 128, 131, 130,
+  126, 126, 128, 128, 128, 130, 129, 127, 125, 127, 131, 130, 127, 126, 127, 128,
+  128, 129, 130, 127, 125, 127, 131, 131, 127, 126, 127, 128, 128, 129, 130, 127,
+  125, 126, 130, 131, 128, 126, 127, 128, 128, 129, 130, 128, 125, 126, 130, 131,
+  128, 126, 127, 128, 128, 129, 130, 128, 125, 126, 129, 131, 129, 126, 126, 128,
+  128, 129, 130, 129, 126, 125, 129, 131, 129, 126, 126, 128, 128, 129, 129, 129,
+  126, 125, 128, 131, 130, 126, 126, 128, 129, 129, 129, 129, 127, 125, 128, 131,
+  130, 127, 126, 127, 129, 128, 129, 129, 127, 125, 127, 131, 131, 127, 126, 127,
+  128, 128, 129, 129, 128, 125, 127, 130, 131, 128, 126, 127, 128, 129, 129, 129,
+  128, 125, 126, 130, 131, 128, 126, 127, 128, 129, 129, 129, 128, 126, 126, 129,
+  131, 129, 126, 126, 128, 129, 129, 129, 129, 126, 125, 129, 131, 129, 126, 126,
+  128, 129, 129, 129, 129, 126, 125, 128, 131, 130, 126, 126, 128, 129, 129, 129,
+  129, 127, 125, 128, 131, 130, 127, 126, 127, 129, 129, 129, 129, 127, 125, 127,
+  131, 131, 127, 126, 127, 129, 129, 129, 129, 128, 125, 127, 130, 131, 128, 126,
+  127, 129, 129, 129, 129, 128, 126, 126, 130, 131, 128, 126, 127, 128, 129, 129,
+  129, 128, 126, 126, 129, 131, 129, 126, 126, 128, 129, 129, 129, 128, 126, 126,
+  129, 131, 129, 126, 126, 128, 129, 129, 129, 129, 127, 126, 128, 131, 130, 126,
+  126, 128, 129, 129, 129, 129, 127, 126, 128, 131, 130, 127, 126, 128, 129, 129,
+  129, 129, 127, 126, 127, 130, 130, 127, 126, 127, 129, 129, 129, 129, 128, 126,
+  127, 130, 131, 128, 126, 127, 129, 129, 129, 129, 128, 126, 126, 130, 131, 128,
+  126, 127, 129, 129, 129, 129, 128, 126, 126, 129, 131, 129, 126, 126, 128, 129,
+  129, 129, 128, 126, 126, 129, 131, 129, 126, 126, 128, 129, 129, 129, 128, 127,
+  126, 128, 131, 130, 126, 126, 128, 129, 129, 129, 129, 127, 126, 128, 131, 130,
+  127, 126, 128, 129, 129, 129, 129, 127, 126, 127, 130, 130, 127, 126, 127, 129,
+  129, 129, 129, 128, 126, 127, 130, 130, 128, 126, 127, 129, 129, 129, 129, 128,
+  126, 127, 129, 131, 128, 126, 127, 129, 129, 129, 129, 128, 126, 126, 129, 131,
+  129, 126, 126, 128, 129, 129, 129, 128, 127, 126, 129, 131, 129, 126, 126, 128,
+  129, 129, 129, 128, 127, 126, 128, 131, 129, 127, 126, 128, 129, 129, 129, 128,
+  127, 126, 128, 130, 130, 127, 126, 128, 129, 129, 128, 129, 127, 126, 127, 130,
+  130, 127, 126, 127, 129, 129, 128, 129, 128, 126, 127, 130, 130, 128, 126, 127,
+  129, 129, 128, 129, 128, 126, 127, 129, 130, 128, 126, 127, 129, 129, 128, 129,
+  128, 126, 127, 129, 130, 129, 126, 126, 128, 129, 128, 128, 128, 127, 126, 129,
+  130, 129, 126, 126, 128, 129, 129, 128, 128, 127, 126, 128, 130, 129, 127, 126,
+  128, 129, 129, 128, 128, 127, 126, 128, 130, 130, 127, 126, 128, 129, 129, 128,
+  128, 127, 126, 127, 130, 130, 127, 126, 127, 129, 129, 128, 128, 128, 126, 127,
+  130, 130, 128, 126, 127, 129, 129, 128, 128, 128, 126, 127, 129, 130, 128, 126,
+  127, 129, 129, 128, 128, 128, 127, 127, 129, 130, 129, 126, 126, 128, 129, 128,
+  128, 128, 127, 127, 129, 130, 129, 126, 126, 128, 129, 129, 128, 128, 127, 126,
+  128, 130, 129, 127, 126, 128, 129, 129, 128, 128, 127, 126, 128, 130, 130, 127,
+  126, 128, 129, 129, 128, 128, 127, 126, 128, 130, 130, 127, 126, 127, 129, 129,
+  128, 128, 128, 127, 127, 130, 130, 128, 126, 127, 129, 129, 128, 128, 128, 127,
+  127, 129, 130, 128, 126, 127, 129, 129, 128, 128, 128, 127, 127, 129, 130, 128,
+  126, 127, 129, 129, 128, 128, 128, 127, 127, 129, 130, 129, 126, 126, 128, 129,
+  129, 128, 128, 127, 127, 128, 130, 129, 127, 126, 128, 129, 129, 128, 128, 127,
+  127, 128, 130, 129, 127, 126, 128, 129, 129, 128, 128, 127, 127, 128, 130, 130,
+  127, 126, 127, 129, 129, 128, 128, 128, 127, 127, 129, 130, 128, 126, 127, 129,
+  129, 128, 128, 128, 127, 127, 129, 130, 128, 126, 127, 129, 129, 128, 128, 128,
+  127, 127, 129, 130, 128, 126, 127, 129, 129, 128, 128, 128, 127, 127, 129, 130,
+  129, 126, 126, 128, 129, 129, 128, 128, 127, 127, 128, 130, 129, 127, 126, 128,
+  129, 129, 128, 128, 127, 127, 128, 130, 129, 127, 126, 128, 129, 129, 128, 128,
+  128, 127, 128, 130, 130, 127, 126, 127, 129, 129, 128, 128, 128, 127, 127, 129,
+  130, 128, 126, 127, 129, 129, 128, 128, 128, 127, 127, 129, 130, 128, 126, 127,
+  129, 129, 128, 128, 128, 127, 127, 129, 130, 128, 126, 127, 129, 129, 128, 128,
+  128, 127, 127, 128, 130, 129, 127, 126, 128, 129, 129, 128, 128, 127, 127, 128,
+  130, 129, 127, 126, 128, 129, 129, 128, 128, 127, 127, 128, 130, 129, 127, 126,
+  128, 129, 129, 128, 128, 128, 127, 128, 129, 129, 127, 126, 127, 129, 129, 128,
+  128, 128, 127, 128, 129, 130, 128, 126, 127, 129, 129, 128, 128, 128, 127, 127,
+  129, 130, 128, 126, 127, 129, 129, 128, 128, 128, 127, 127, 129, 130, 128, 126,
+  127, 129, 129, 128, 128, 128, 127, 127, 128, 130, 129, 127, 127, 128, 129, 128,
+  128, 128, 127, 127, 128, 130, 129, 127, 126, 128, 129, 129, 128, 128, 128, 127,
+  128, 129, 129, 127, 126, 128, 129, 129, 128, 128, 128, 127, 128, 129, 129, 127,
+  126, 128, 129, 129, 128, 128, 128, 127, 128, 129, 129, 128, 126, 127, 129, 129,
+  128, 128, 128, 127, 127, 129, 130, 128, 126, 127, 129, 129, 128, 128, 128, 127,
+  127, 129, 130, 128, 127, 127, 129, 129, 128, 128, 128, 127, 127, 128, 129, 129,
+  127, 127, 128, 129, 128, 128, 128, 128, 127, 128, 129, 129, 127, 126, 128, 129,
+  129, 128, 128, 128, 127, 128, 129, 129, 127, 126, 128, 129, 129, 128, 128, 128,
+  127, 128, 129, 129, 127, 126, 128, 129, 129, 128, 128, 128, 127, 128, 129, 129,
+  128, 126, 127, 129, 129, 128, 128, 128, 127, 128, 129, 129, 128, 126, 127, 129,
+  129, 128, 128, 128, 127, 127, 129, 129, 128, 127, 127, 129, 129, 128, 128, 128,
+  128, 127, 128, 129, 129, 127, 127, 128, 129, 128, 128, 128, 128, 127, 128, 129,
+  129, 127, 127, 128, 129, 129, 128, 128, 128, 127, 128, 129, 129, 127, 126, 128,
+};
+
+// Ding curto: C7 com harmônico, 0,25 s
+static const uint8_t clip_ding_samples[] = {
+  128, 129, 128, 124, 130, 132, 126, 119, 135, 134, 123, 116, 142, 133, 118, 117,
+  148, 131, 111, 122, 151, 128, 103, 132, 152, 124,  97, 145, 149, 119,  94, 158,
+  144, 110,  97, 168, 139, 100, 107, 174, 133,  89, 123, 170, 126,  83, 142, 163,
+  120,  82, 157, 153, 113,  87, 168, 144, 104,  97, 173, 137,  95, 113, 172, 130,
+   88, 130, 166, 124,  84, 147, 158, 118,  85, 161, 149, 110,  91, 169, 141, 102,
+  103, 172, 134,  94, 119, 169, 128,  87, 136, 162, 122,  85, 152, 154, 116,  88,
+  163, 145, 108,  96, 169, 138, 100, 110, 170, 132,  92, 126, 165, 126,  88, 142,
+  158, 120,  87, 156, 150, 113,  92, 165, 142, 106, 102, 168, 135,  98, 116, 167,
+  129,  92, 132, 161, 124,  88, 147, 154, 118,  90, 159, 146, 111,  96, 165, 139,
+  104, 108, 167, 133,  97, 122, 164, 127,  91, 137, 158, 122,  90, 151, 150, 116,
+   93, 160, 142, 109, 101, 165, 136, 102, 113, 165, 131,  95, 128, 161, 126,  92,
+  142, 154, 120,  92, 154, 146, 114,  97, 162, 139, 107, 106, 164, 134, 100, 119,
+  162, 129,  95, 133, 157, 124,  92, 146, 150, 118,  94, 156, 143, 112, 101, 162,
+  137, 105, 111, 163, 132,  99, 124, 159, 127,  95, 138, 154, 122,  94, 150, 147,
+  117,  97, 158, 140, 110, 105, 161, 135, 104, 116, 161, 130,  98, 129, 156, 125,
+   95, 142, 150, 120,  96, 152, 144, 115, 101, 158, 138, 109, 110, 160, 132, 103,
+  121, 158, 128,  98, 134, 153, 124,  96, 146, 147, 119,  98, 154, 141, 113, 105,
+  159, 135, 107, 114, 159, 131, 102, 126, 156, 127,  98, 138, 150, 122,  98, 148,
+  144, 117, 101, 155, 138, 112, 109, 158, 133, 106, 119, 157, 129, 101, 131, 153,
+  125,  99, 142, 147, 121, 100, 151, 141, 116, 104, 156, 136, 110, 113, 157, 131,
+  105, 124, 155, 128, 101, 135, 150, 124, 100, 145, 144, 119, 102, 152, 139, 114,
+  108, 155, 134, 109, 117, 155, 130, 104, 128, 152, 126, 101, 138, 147, 122, 101,
+  147, 142, 118, 105, 153, 137, 113, 112, 155, 132, 108, 121, 153, 129, 104, 132,
+  150, 125, 102, 141, 144, 121, 103, 149, 139, 116, 108, 153, 135, 111, 116, 154,
+  131, 107, 125, 151, 127, 103, 135, 147, 124, 103, 144, 142, 120, 105, 150, 137,
+  115, 111, 153, 133, 110, 119, 152, 129, 106, 129, 149, 126, 104, 138, 145, 122,
+  104, 146, 140, 118, 108, 151, 135, 114, 114, 152, 131, 109, 123, 150, 128, 106,
+  132, 147, 125, 104, 141, 142, 121, 106, 147, 138, 117, 111, 151, 133, 113, 118,
+  151, 130, 109, 127, 148, 127, 106, 135, 144, 124, 106, 143, 140, 120, 108, 148,
+  136, 116, 114, 150, 132, 112, 121, 149, 129, 108, 130, 146, 126, 106, 138, 142,
+  123, 107, 145, 138, 119, 111, 148, 134, 115, 117, 149, 131, 111, 125, 148, 128,
+  108, 133, 144, 125, 107, 140, 140, 122, 109, 146, 136, 118, 113, 148, 132, 114,
+  120, 148, 129, 110, 128, 146, 127, 108, 136, 142, 124, 108, 142, 138, 120, 111,
+  146, 134, 117, 116, 148, 131, 113, 123, 147, 128, 110, 131, 144, 126, 109, 138,
+  140, 123, 109, 143, 136, 119, 113, 146, 133, 116, 119, 147, 130, 112, 126, 145,
+  127, 110, 133, 142, 125, 109, 140, 138, 122, 111, 144, 135, 118, 115, 146, 132,
+  115, 122, 146, 129, 112, 129, 144, 127, 110, 136, 140, 124, 110, 141, 137, 121,
+  113, 145, 133, 118, 118, 146, 131, 114, 124, 145, 128, 112, 131, 142, 126, 111,
+  138, 139, 123, 112, 142, 135, 120, 115, 145, 132, 117, 120, 145, 130, 114, 127,
+  143, 127, 112, 133, 140, 125, 111, 139, 137, 122, 113, 143, 134, 119, 117, 144,
+  131, 116, 123, 144, 129, 113, 129, 142, 126, 112, 135, 139, 124, 112, 140, 135,
+  121, 115, 143, 132, 118, 120, 144, 130, 115, 125, 143, 128, 113, 132, 140, 126,
+  112, 137, 137, 123, 114, 141, 134, 120, 117, 143, 131, 118, 122, 143, 129, 115,
+  128, 141, 127, 113, 134, 139, 125, 113, 138, 136, 122, 115, 142, 133, 120, 119,
+  143, 130, 117, 124, 142, 128, 115, 130, 140, 126, 114, 135, 137, 124, 114, 139,
+  134, 122, 117, 142, 132, 119, 121, 142, 130, 116, 126, 141, 128, 115, 132, 138,
+  126, 114, 137, 136, 123, 115, 140, 133, 121, 119, 142, 131, 118, 123, 141, 129,
+  116, 128, 140, 127, 115, 134, 137, 125, 115, 138, 134, 123, 117, 140, 132, 120,
+  120, 141, 130, 118, 125, 140, 128, 116, 130, 138, 126, 115, 135, 136, 124, 116,
+  138, 133, 122, 118, 140, 131, 120, 122, 140, 129, 117, 127, 139, 127, 116, 132,
+  137, 126, 116, 136, 135, 124, 117, 139, 132, 121, 120, 140, 130, 119, 124, 140,
+  128, 117, 129, 138, 127, 116, 133, 136, 125, 116, 137, 133, 123, 118, 139, 131,
+  121, 122, 140, 129, 119, 126, 139, 128, 117, 131, 137, 126, 117, 135, 135, 125,
+  117, 138, 132, 122, 120, 139, 130, 120, 123, 139, 129, 118, 128, 138, 127, 117,
+  132, 136, 126, 117, 136, 134, 124, 118, 138, 132, 122, 121, 139, 130, 120, 125,
+  138, 128, 118, 129, 137, 127, 117, 133, 135, 125, 118, 136, 133, 123, 120, 138,
+  131, 121, 123, 138, 129, 119, 127, 137, 128, 118, 131, 136, 126, 118, 134, 134,
+  125, 119, 137, 132, 123, 121, 138, 130, 121, 124, 138, 129, 119, 128, 137, 127,
+  118, 132, 135, 126, 118, 135, 133, 124, 120, 137, 131, 122, 122, 138, 129, 120,
+  126, 137, 128, 119, 130, 136, 127, 118, 133, 134, 125, 119, 136, 132, 124, 121,
+  137, 130, 122, 124, 137, 129, 120, 127, 136, 128, 119, 131, 135, 126, 119, 134,
+  133, 125, 120, 136, 131, 123, 122, 137, 130, 121, 125, 137, 128, 120, 129, 135,
+  127, 119, 132, 134, 126, 119, 135, 132, 124, 121, 136, 130, 123, 123, 137, 129,
+  121, 127, 136, 128, 120, 130, 135, 127, 119, 133, 133, 125, 120, 135, 131, 124,
+  122, 136, 130, 122, 125, 136, 129, 121, 128, 135, 128, 120, 131, 134, 126, 120,
+  134, 132, 125, 121, 135, 131, 123, 123, 136, 129, 122, 126, 136, 128, 121, 129,
+  135, 127, 120, 132, 133, 126, 120, 134, 131, 125, 122, 135, 130, 123, 124, 136,
+  129, 122, 127, 135, 128, 121, 130, 134, 127, 120, 133, 132, 126, 121, 135, 131,
+  124, 123, 135, 130, 123, 125, 135, 128, 121, 128, 134, 127, 121, 131, 133, 126,
+  121, 133, 132, 125, 122, 135, 130, 124, 124, 135, 129, 122, 126, 135, 128, 121,
+  129, 134, 127, 121, 132, 132, 126, 121, 134, 131, 125, 123, 135, 130, 123, 125,
+  135, 129, 122, 127, 134, 128, 121, 130, 133, 127, 121, 132, 132, 126, 122, 134,
+  130, 124, 124, 135, 129, 123, 126, 134, 128, 122, 128, 134, 127, 121, 131, 132,
+  126, 122, 133, 131, 125, 123, 134, 130, 124, 125, 134, 129, 123, 127, 134, 128,
+  122, 129, 133, 127, 122, 132, 132, 126, 122, 133, 130, 125, 123, 134, 129, 124,
+  125, 134, 128, 123, 128, 133, 128, 122, 130, 132, 127, 122, 132, 131, 126, 123,
+  133, 130, 125, 124, 134, 129, 124, 126, 134, 128, 123, 129, 133, 127, 122, 131,
+  132, 126, 122, 133, 131, 125, 123, 134, 130, 124, 125, 134, 129, 123, 127, 133,
+  128, 123, 129, 132, 127, 122, 131, 131, 126, 123, 133, 130, 125, 124, 133, 129,
+  124, 126, 133, 128, 123, 128, 133, 128, 123, 130, 132, 127, 123, 132, 131, 126,
+  123, 133, 130, 125, 125, 133, 129, 124, 127, 133, 128, 123, 129, 132, 127, 123,
+  131, 131, 127, 123, 132, 130, 126, 124, 133, 129, 125, 126, 133, 128, 124, 128,
+  133, 128, 123, 130, 132, 127, 123, 131, 131, 126, 124, 132, 130, 125, 125, 133,
+  129, 124, 126, 133, 128, 124, 128, 132, 128, 123, 130, 131, 127, 123, 132, 130,
+  126, 124, 133, 129, 125, 125, 133, 129, 124, 127, 132, 128, 124, 129, 132, 127,
+  123, 131, 131, 127, 124, 132, 130, 126, 125, 132, 129, 125, 126, 132, 128, 124,
+  128, 132, 128, 124, 130, 131, 127, 124, 131, 130, 126, 124, 132, 129, 126, 125,
+  132, 129, 125, 127, 132, 128, 124, 128, 132, 128, 124, 130, 131, 127, 124, 131,
+  130, 126, 125, 132, 129, 125, 126, 132, 128, 125, 127, 132, 128, 124, 129, 131,
+  127, 124, 131, 130, 127, 124, 132, 130, 126, 125, 132, 129, 125, 126, 132, 128,
+  124, 128, 132, 128, 124, 130, 131, 127, 124, 131, 130, 126, 125, 132, 129, 126,
+  126, 132, 129, 125, 127, 132, 128, 124, 129, 131, 128, 124, 130, 130, 127, 124,
+  131, 130, 126, 125, 132, 129, 126, 126, 132, 128, 125, 128, 131, 128, 124, 129,
+  131, 127, 124, 130, 130, 127, 125, 131, 129, 126, 126, 132, 129, 125, 127, 132,
+  128, 125, 128, 131, 128, 124, 130, 130, 127, 125, 131, 130, 127, 125, 131, 129,
+  126, 126, 132, 128, 125, 127, 131, 128, 125, 129, 131, 128, 125, 130, 130, 127,
+  125, 131, 129, 126, 125, 131, 129, 126, 127, 131, 128, 125, 128, 131, 128, 125,
+  129, 130, 127, 125, 130, 130, 127, 125, 131, 129, 126, 126, 131, 129, 126, 127,
+  131, 128, 125, 128, 131, 128, 125, 130, 130, 127, 125, 130, 129, 127, 125, 131,
+  129, 126, 126, 131, 128, 125, 128, 131, 128, 125, 129, 130, 128, 125, 130, 130,
+  127, 125, 131, 129, 126, 126, 131, 129, 126, 127, 131, 128, 125, 128, 131, 128,
+  125, 129, 130, 127, 125, 130, 129, 127, 125, 131, 129, 126, 126, 131, 128, 126,
+  127, 131, 128, 125, 128, 130, 128, 125, 130, 130, 127, 125, 130, 129, 127, 126,
+  131, 129, 126, 127, 131, 128, 126, 128, 131, 128, 125, 129, 130, 128, 125, 130,
+  129, 127, 126, 130, 129, 127, 126, 131, 129, 126, 127, 131, 128, 126, 128, 130,
+  128, 125, 129, 130, 127, 125, 130, 129, 127, 126, 130, 129, 126, 127, 131, 128,
+  126, 128, 130, 128, 126, 129, 130, 128, 125, 129, 130, 127, 126, 130, 129, 127,
+  126, 130, 129, 126, 127, 130, 128, 126, 128, 130, 128, 126, 129, 130, 128, 126,
+  130, 129, 127, 126, 130, 129, 127, 126, 130, 128, 126, 127, 130, 128, 126, 128,
+  130, 128, 126, 129, 130, 127, 126, 130, 129, 127, 126, 130, 129, 127, 127, 130,
+  128, 126, 128, 130, 128, 126, 129, 130, 128, 126, 129, 129, 127, 126, 130, 129,
+  127, 126, 130, 128, 126, 127, 130, 128, 126, 128, 130, 128, 126, 129, 130, 128,
+  126, 130, 129, 127, 126, 130, 129, 127, 127, 130, 128, 126, 127, 130, 128, 126,
+  128, 130, 128, 126, 129, 129, 127, 126, 130, 129, 127, 126, 130, 129, 127, 127,
+  130, 128, 126, 128, 130, 128, 126, 129, 130, 128, 126, 129, 129, 127, 126, 130,
+  129, 127, 127, 130, 128, 127, 127, 130, 128, 126, 128, 130, 128, 126, 129, 129,
+  128, 126, 129, 129, 127, 126, 130, 129, 127, 127, 130, 128, 126, 128, 130, 128,
+  126, 128, 129, 128, 126, 129, 129, 127, 126, 130, 129, 127, 127, 130, 128, 127,
+  127, 130, 128, 126, 128, 130, 128, 126, 129, 129, 128, 126, 129, 129, 127, 126,
+  130, 129, 127, 127, 130, 128, 127, 127, 130, 128, 126, 128, 129, 128, 126, 129,
+  129, 128, 126, 129, 129, 127, 127, 130, 128, 127, 127, 130, 128, 127, 128, 130,
+  128, 126, 128, 129, 128, 126, 129, 129, 127, 126, 129, 129, 127, 127, 130, 128,
+  127, 127, 130, 128, 127, 128, 129, 128, 126, 129, 129, 128, 126, 129, 129, 127,
+  127, 129, 129, 127, 127, 130, 128, 127, 128, 130, 128, 127, 128, 129, 128, 126,
+  129, 129, 128, 127, 129, 129, 127, 127, 129, 128, 127, 127, 130, 128, 127, 128,
+};
+
+static const pcm_clip_t clip_chime = { clip_chime_samples, sizeof(clip_chime_samples) };
+static const pcm_clip_t clip_ding = { clip_ding_samples, sizeof(clip_ding_samples) };
+
+#endif
@@ -0,0 +1,37 @@
+#include "console.h"
+#include "sched.h"
+
+typedef struct {
+  char key;
+  console_cmd_t cmd;
+} console_entry_t;
+
+static console_entry_t commands[CONSOLE_MAX_COMMANDS];
+static uint8_t command_count;
+
+// Poll do agendador: atende o que chegou pela USB sem esperar
+static bool console_poll(void) {
+  int c = getchar_timeout_us(0);
+  if (c == PICO_ERROR_TIMEOUT)
+    return false;
+  for (uint8_t i = 0; i < command_count; ++i) {
+    if (commands[i].key == c)
+      commands[i].cmd();
+  }
+  return true;
+}
+
+void console_init(void) {
+  command_count = 0;
+  sched_add_poll(console_poll);
+}
+
+// Registro só na inicialização: um comando a mais que a tabela é erro de
+// configuração, então para com hard_assert em vez de sumir em silêncio
+bool console_add_command(char key, console_cmd_t cmd) {
+  hard_assert(command_count < CONSOLE_MAX_COMMANDS);
+  if (command_count >= CONSOLE_MAX_COMMANDS)
+    return false;
+  commands[command_count++] = (console_entry_t){ key, cmd };
+  return true;
+}
@@ -0,0 +1,19 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include "pico/stdlib.h"
+#include "perf.h"
+#include "trace.h"
+
+// Um comando por módulo que registra: 'h' (histórico) e 'e' (energia)
+// sempre, 'p' e 't' só com PERF_ENABLED e TRACE_ENABLED
+#define CONSOLE_MAX_COMMANDS (2 + PERF_ENABLED + TRACE_ENABLED)
+
+// Comandos de um caractere recebidos pela USB (stdio), atendidos por um
+// poll do agendador, fora de IRQ
+typedef void (*console_cmd_t)(void);
+
+void console_init(void);
+bool console_add_command(char key, console_cmd_t cmd);
+
+#endif
@@ -0,0 +1,65 @@
+#include "cursor.h"
+#include <stdlib.h>
+
+// Cursor analógico em passo fixo: a cada CURSOR_STEP_US a deflexão do
+// joystick vira velocidade pela curva e a velocidade é somada a um
+// acumulador de posição com resolução de 1/65536 de célula. Assim um desvio
+// pequeno anda devagar, sem o cursor pular uma célula por tick.
+
+// Velocidade (centésimos de célula/s) para um desvio, interpolando a curva
+static int32_t cursor_speed(const cursor_curve_t *curve, int16_t deflection) {
+  uint16_t d = abs(deflection);
+  const cursor_curve_point_t *p = curve->points;
+  int32_t speed = 0;
+
+  if (d >= p[curve->count - 1].deflection) {
+    speed = p[curve->count - 1].speed;
+  } else if (d >= p[0].deflection) {
+    for (uint8_t i = 1; i < curve->count; ++i) {
+      if (d < p[i].deflection) {
+        speed = p[i - 1].speed + (int32_t)(p[i].speed - p[i - 1].speed) *
+                (d - p[i - 1].deflection) / (p[i].deflection - p[i - 1].deflection);
+        break;
+      }
+    }
+  }
+  return deflection < 0 ? -speed : speed;
+}
+
+static int32_t cursor_clamp(int32_t v, uint8_t cells) {
+  if (v < 0)
+    return 0;
+  if (v > (cells - 1) * CURSOR_ONE)
+    return (cells - 1) * CURSOR_ONE;
+  return v;
+}
+
+void cursor_init(cursor_t *cursor, const cursor_curve_t *curve, uint8_t width, uint8_t height) {
+  cursor->curve = curve;
+  cursor->width = width;
+  cursor->height = height;
+  cursor_place(cursor, width / 2, height / 2);
+}
+
+// Coloca o cursor no centro de uma célula
+void cursor_place(cursor_t *cursor, int x, int y) {
+  cursor->x = cursor_clamp(x * CURSOR_ONE, cursor->width);
+  cursor->y = cursor_clamp(y * CURSOR_ONE, cursor->height);
+}
+
+// Avança um passo fixo com a deflexão (dx, dy) já sem a zona morta
+void cursor_step(cursor_t *cursor, int16_t dx, int16_t dy) {
+  // centésimos de célula/s × Q16 × passo: deslocamento em Q16 neste passo
+  int64_t scale = (int64_t)CURSOR_ONE * CURSOR_STEP_US / 100;
+  cursor->x = cursor_clamp(cursor->x + (int32_t)(cursor_speed(cursor->curve, dx) * scale / 1000000), cursor->width);
+  cursor->y = cursor_clamp(cursor->y + (int32_t)(cursor_speed(cursor->curve, dy) * scale / 1000000), cursor->height);
+}
+
+// Célula mais próxima da posição acumulada
+int cursor_cell_x(const cursor_t *cursor) {
+  return (cursor->x + CURSOR_ONE / 2) / CURSOR_ONE;
+}
+
+int cursor_cell_y(const cursor_t *cursor) {
+  return (cursor->y + CURSOR_ONE / 2) / CURSOR_ONE;
+}
@@ -0,0 +1,37 @@
+#ifndef CURSOR_H
+#define CURSOR_H
+
+#include "pico/stdlib.h"
+
+#define CURSOR_STEP_US 2000 // Passo fixo da simulação (500 Hz)
+#define CURSOR_ONE 65536    // Uma célula no acumulador de posição (Q16)
+
+// Ponto da curva de aceleração: desvio do joystick (contagens do ADC a partir
+// do centro) -> velocidade em centésimos de célula por segundo. Entre pontos
+// a velocidade é interpolada; abaixo do primeiro ela é zero e acima do
+// último fica constante.
+typedef struct {
+  uint16_t deflection;
+  uint16_t speed;
+} cursor_curve_point_t;
+
+typedef struct {
+  const cursor_curve_point_t *points; // Em ordem crescente de desvio
+  uint8_t count;
+} cursor_curve_t;
+
+#define CURSOR_CURVE(points) { (points), sizeof(points) / sizeof((points)[0]) }
+
+typedef struct {
+  int32_t x, y; // Posição em Q16 (células)
+  uint8_t width, height;
+  const cursor_curve_t *curve;
+} cursor_t;
+
+void cursor_init(cursor_t *cursor, const cursor_curve_t *curve, uint8_t width, uint8_t height);
+void cursor_place(cursor_t *cursor, int x, int y);
+void cursor_step(cursor_t *cursor, int16_t dx, int16_t dy);
+int cursor_cell_x(const cursor_t *cursor);
+int cursor_cell_y(const cursor_t *cursor);
+
+#endif
@@ -1,5 +1,5 @@
 
-static uint8_t font[] = {
+static const uint8_t font[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Nothing
 0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, //0
 0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, //1
@@ -63,4 +63,49 @@ static uint8_t font[] = {
 0x44, 0x28, 0x10, 0x10, 0x28, 0x44, 0x00, 0x00, // x
 0x4C, 0x90, 0x90, 0x90, 0x90, 0x7C, 0x00, 0x00, // y
 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x00, 0x00, // z
-};
\ No newline at end of file
+0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, // !
+0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, // "
+0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x00, 0x00, // #
+0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00, 0x00, 0x00, // $
+0x23, 0x13, 0x08, 0x64, 0x62, 0x00, 0x00, 0x00, // %
+0x36, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00, 0x00, // &
+0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // '
+0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, // (
+0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, // )
+0x14, 0x08, 0x3E, 0x08, 0x14, 0x00, 0x00, 0x00, // *
+0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, 0x00, // +
+0x00, 0x50, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // ,
+0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, // -
+0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // .
+0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, // /
+0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, // :
+0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, // ;
+0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, // <
+0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, // =
+0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, // >
+0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x00, 0x00, // ?
+0x32, 0x49, 0x79, 0x41, 0x3E, 0x00, 0x00, 0x00, // @
+0x00, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00, // [
+0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00, 0x00, // barra invertida
+0x00, 0x41, 0x41, 0x7F, 0x00, 0x00, 0x00, 0x00, // ]
+0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, // ^
+0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, // _
+0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, // `
+0x00, 0x08, 0x36, 0x41, 0x00, 0x00, 0x00, 0x00, // {
+0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, // |
+0x00, 0x41, 0x36, 0x08, 0x00, 0x00, 0x00, 0x00, // }
+0x08, 0x04, 0x08, 0x10, 0x08, 0x00, 0x00, 0x00, // ~
+};
+
+// Índice do glifo em font[] para cada caractere ASCII imprimível (0x20..0x7E)
+#define FONT_FIRST_CHAR 0x20
+#define FONT_LAST_CHAR 0x7E
+
+static const uint8_t font_index[FONT_LAST_CHAR - FONT_FIRST_CHAR + 1] = {
+ 0, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, //  !"#$%&'()*+,-./
+ 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 78, 79, 80, 81, 82, 83, // 0123456789:;<=>?
+84, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, // @ABCDEFGHIJKLMNO
+26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 85, 86, 87, 88, 89, // PQRSTUVWXYZ[\]^_
+90, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, // `abcdefghijklmno
+52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 91, 92, 93, 94, // pqrstuvwxyz{|}~
+};
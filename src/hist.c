@@ -0,0 +1,69 @@
+#include "hist.h"
+
+// Balde de um valor: abaixo de HIST_SUB, um balde por valor; acima, o
+// expoente escolhe a faixa e os HIST_SUB_BITS seguintes o balde dentro dela
+static uint hist_bucket(uint32_t value) {
+  if (value < HIST_SUB)
+    return value;
+  uint exp = 31 - __builtin_clz(value);
+  uint bucket = (exp - HIST_SUB_BITS + 1) * HIST_SUB + ((value >> (exp - HIST_SUB_BITS)) & (HIST_SUB - 1));
+  return bucket < HIST_BUCKETS ? bucket : HIST_BUCKETS - 1;
+}
+
+// Menor valor do balde e largura dele
+static uint32_t hist_bucket_low(uint bucket, uint32_t *width) {
+  if (bucket < HIST_SUB) {
+    *width = 1;
+    return bucket;
+  }
+  uint exp = bucket / HIST_SUB + HIST_SUB_BITS - 1;
+  *width = 1u << (exp - HIST_SUB_BITS);
+  return (1u << exp) + (bucket % HIST_SUB) * *width;
+}
+
+void hist_reset(hist_t *hist) {
+  *hist = (hist_t){ .min = UINT32_MAX };
+}
+
+void hist_add(hist_t *hist, uint32_t value) {
+  uint bucket = hist_bucket(value);
+  if (hist->buckets[bucket] == UINT16_MAX)
+    return; // Contador saturado: descarta para não distorcer os percentis
+  hist->buckets[bucket]++;
+  hist->count++;
+  hist->sum += value;
+  if (value < hist->min)
+    hist->min = value;
+  if (value > hist->max)
+    hist->max = value;
+}
+
+uint32_t hist_mean(const hist_t *hist) {
+  return hist->count ? hist->sum / hist->count : 0;
+}
+
+// Valor abaixo do qual ficam `percent`% das amostras (meio do balde, limitado
+// ao mínimo e ao máximo observados)
+uint32_t hist_percentile(const hist_t *hist, uint8_t percent) {
+  if (!hist->count)
+    return 0;
+
+  uint32_t rank = ((uint64_t)hist->count * percent + 99) / 100;
+  if (rank == 0)
+    rank = 1;
+
+  uint32_t seen = 0;
+  for (uint b = 0; b < HIST_BUCKETS; ++b) {
+    seen += hist->buckets[b];
+    if (seen >= rank) {
+      uint32_t width;
+      uint32_t value = hist_bucket_low(b, &width) + width / 2;
+      if (value < hist->min)
+        value = hist->min;
+      if (value > hist->max)
+        value = hist->max;
+      return value;
+    }
+  }
+  return hist->max;
+}
@@ -0,0 +1,25 @@
+#ifndef HIST_H
+#define HIST_H
+
+#include "pico/stdlib.h"
+
+// Histograma de streaming em memória constante: cada valor cai em um balde
+// log-linear (16 baldes por potência de 2, erro relativo máximo de 1/16).
+// Mínimo, máximo e média são exatos; percentis são o meio do balde.
+#define HIST_SUB_BITS 4
+#define HIST_SUB (1u << HIST_SUB_BITS)
+#define HIST_BUCKETS (HIST_SUB * 23) // Até 2^26 µs (~67 s); acima disso, o último balde
+
+typedef struct {
+  uint32_t count;
+  uint32_t min, max;
+  uint64_t sum;
+  uint16_t buckets[HIST_BUCKETS];
+} hist_t;
+
+void hist_reset(hist_t *hist);
+void hist_add(hist_t *hist, uint32_t value);
+uint32_t hist_mean(const hist_t *hist);
+uint32_t hist_percentile(const hist_t *hist, uint8_t percent);
+
+#endif
@@ -0,0 +1,170 @@
+#include "input.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+#include "trace.h"
+#include "perf.h"
+
+// Entrada dos botões em duas metades:
+// - a IRQ só lê o nível do pino, marca o instante e empilha a borda em um
+//   anel SPSC (produtor: IRQ, consumidor: poll do agendador), sem travas;
+// - o poll faz o debounce com temporizadores e posta press/release/long-press
+//   como eventos do agendador, com o instante da borda como timestamp.
+// Botões ativos em nível baixo (pull-up interno).
+
+typedef struct {
+  uint gpio;
+  uint16_t event;
+  bool pressed;      // Estado estável após o debounce
+  bool locked;       // Dentro da janela de debounce
+  sched_timer_t debounce_timer;
+  sched_timer_t long_timer;
+} input_button_t;
+
+typedef struct {
+  uint8_t button;
+  bool pressed;
+  uint64_t timestamp;
+} input_edge_t;
+
+static input_button_t buttons[INPUT_MAX_BUTTONS];
+static uint8_t button_count;
+static uint32_t gpio_mask;
+
+static input_edge_t ring[INPUT_RING_LEN];
+static volatile uint8_t ring_head; // Escrito só pela IRQ
+static volatile uint8_t ring_tail; // Escrito só pelo consumidor
+
+static input_stats_t stats;
+
+static void input_irq(void) {
+  PERF_BEGIN();
+  uint32_t start = systick_hw->cvr;
+
+  for (uint8_t i = 0; i < button_count; ++i) {
+    uint gpio = buttons[i].gpio;
+    uint32_t events = gpio_get_irq_event_mask(gpio) & (GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE);
+    if (!events)
+      continue;
+    gpio_acknowledge_irq(gpio, events);
+    stats.edges++;
+
+    uint8_t head = ring_head;
+    uint8_t next = (head + 1) & (INPUT_RING_LEN - 1);
+    if (next == ring_tail) {
+      stats.dropped++;
+      continue;
+    }
+    ring[head] = (input_edge_t){ .button = i, .pressed = !gpio_get(gpio), .timestamp = time_us_64() };
+    TRACE(TRACE_BUTTON_EDGE, gpio << 1 | ring[head].pressed);
+    __mem_fence_release();
+    ring_head = next;
+  }
+  sched_wake();
+
+  // SysTick conta para baixo em 24 bits
+  uint32_t cycles = (start - systick_hw->cvr) & 0xFFFFFF;
+  if (cycles > stats.isr_max_cycles)
+    stats.isr_max_cycles = cycles;
+  PERF_END(PERF_GPIO_IRQ);
+}
+
+static void input_transition(input_button_t *b, bool pressed, uint64_t timestamp) {
+  b->pressed = pressed;
+  TRACE(TRACE_INPUT_EVENT, b->event << 8 | (pressed ? INPUT_PRESS : INPUT_RELEASE));
+  if (pressed) {
+    sched_post_at(b->event, INPUT_PRESS, timestamp);
+    sched_timer_start(&b->long_timer, INPUT_EV_LONG_PRESS, INPUT_LONG_PRESS_US, false);
+  } else {
+    sched_timer_stop(&b->long_timer);
+    sched_post_at(b->event, INPUT_RELEASE, timestamp);
+  }
+  // A primeira borda é aceita na hora; as seguintes ficam bloqueadas até o
+  // fim da janela, quando o nível do pino é conferido de novo
+  b->locked = true;
+  sched_timer_start(&b->debounce_timer, INPUT_EV_DEBOUNCE, INPUT_DEBOUNCE_US, false);
+}
+
+// Poll do agendador: drena o anel preenchido pela IRQ
+static bool input_poll(void) {
+  bool busy = false;
+  while (ring_tail != ring_head) {
+    uint8_t tail = ring_tail;
+    __mem_fence_acquire();
+    input_edge_t edge = ring[tail];
+    ring_tail = (tail + 1) & (INPUT_RING_LEN - 1);
+
+    input_button_t *b = &buttons[edge.button];
+    if (!b->locked && edge.pressed != b->pressed)
+      input_transition(b, edge.pressed, edge.timestamp);
+    busy = true;
+  }
+  return busy;
+}
+
+// Handler do agendador: expiração dos temporizadores de cada botão
+static void input_handle(const sched_event_t *ev) {
+  if (ev->id != INPUT_EV_DEBOUNCE && ev->id != INPUT_EV_LONG_PRESS)
+    return;
+
+  for (uint8_t i = 0; i < button_count; ++i) {
+    input_button_t *b = &buttons[i];
+    if (ev->timer == &b->debounce_timer) {
+      b->locked = false;
+      bool pressed = !gpio_get(b->gpio);
+      if (pressed != b->pressed)
+        input_transition(b, pressed, time_us_64()); // Borda perdida dentro da janela
+    } else if (ev->timer == &b->long_timer) {
+      if (b->pressed)
+        sched_post(b->event, INPUT_LONG_PRESS);
+    }
+  }
+}
+
+void input_init(void) {
+  button_count = 0;
+  gpio_mask = 0;
+  ring_head = ring_tail = 0;
+  stats = (input_stats_t){0};
+  sched_add_handler(input_handle);
+  sched_add_poll(input_poll);
+}
+
+// Configura o pino com pull-up; cada press/release/long-press do botão é
+// postado como `event` com o input_action_t em `arg`
+bool input_add_button(uint gpio, uint16_t event) {
+  if (button_count >= INPUT_MAX_BUTTONS)
+    return false;
+
+  gpio_init(gpio);
+  gpio_set_dir(gpio, GPIO_IN);
+  gpio_pull_up(gpio);
+
+  buttons[button_count++] = (input_button_t){ .gpio = gpio, .event = event };
+  gpio_mask |= 1u << gpio;
+  sched_mark_input(event);
+  return true;
+}
+
+// Instala um único handler para todos os botões e habilita as bordas
+void input_start(void) {
+  // SysTick livre no clock do processador, só para medir a IRQ
+  systick_hw->rvr = 0xFFFFFF;
+  systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+  gpio_add_raw_irq_handler_masked(gpio_mask, input_irq);
+  for (uint8_t i = 0; i < button_count; ++i) {
+    buttons[i].pressed = !gpio_get(buttons[i].gpio);
+    gpio_set_irq_enabled(buttons[i].gpio, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true);
+  }
+  irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+void input_get_stats(input_stats_t *out, bool reset) {
+  uint32_t status = save_and_disable_interrupts();
+  *out = stats;
+  if (reset)
+    stats = (input_stats_t){0};
+  restore_interrupts(status);
+}
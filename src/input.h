@@ -0,0 +1,34 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "pico/stdlib.h"
+#include "sched.h"
+
+#define INPUT_MAX_BUTTONS 4
+#define INPUT_RING_LEN 32            // Potência de 2
+#define INPUT_DEBOUNCE_US 20000      // Janela em que novas bordas são ignoradas
+#define INPUT_LONG_PRESS_US 800000
+
+// Ids internos dos temporizadores do módulo (fora da faixa dos eventos da aplicação)
+#define INPUT_EV_DEBOUNCE 0xFF00
+#define INPUT_EV_LONG_PRESS 0xFF01
+
+// Valor de `arg` nos eventos postados para cada botão
+typedef enum {
+  INPUT_PRESS,
+  INPUT_RELEASE,
+  INPUT_LONG_PRESS,
+} input_action_t;
+
+typedef struct {
+  uint32_t edges;           // Bordas registradas pela IRQ
+  uint32_t dropped;         // Bordas perdidas com o anel cheio
+  uint32_t isr_max_cycles;  // Maior tempo de execução da IRQ (SysTick)
+} input_stats_t;
+
+void input_init(void);
+bool input_add_button(uint gpio, uint16_t event);
+void input_start(void);
+void input_get_stats(input_stats_t *stats, bool reset);
+
+#endif
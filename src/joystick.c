@@ -0,0 +1,107 @@
+#include "joystick.h"
+#include <stdlib.h>
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "trace.h"
+
+// O ADC converte sem parar em round-robin (entrada 0, 1, 0, 1...) e dois
+// canais de DMA encadeados, um disparando o outro ao terminar, copiam o FIFO
+// para um anel em RAM indefinidamente. A CPU não participa: quem lê só tira
+// a média do anel, que sempre tem as últimas amostras de cada eixo.
+// Cada volta do DMA começa no início do anel e o FIFO não perde amostras,
+// então as posições pares são sempre o eixo Y e as ímpares o X.
+
+static uint16_t ring[JOYSTICK_RING_LEN] __attribute__((aligned(JOYSTICK_RING_LEN * sizeof(uint16_t))));
+static int dma_chan[2];
+static uint16_t center_x = JOYSTICK_CENTER;
+static uint16_t center_y = JOYSTICK_CENTER;
+static uint16_t deadzone = JOYSTICK_DEADZONE;
+
+void joystick_init(void) {
+  adc_init();
+  adc_gpio_init(26);
+  adc_gpio_init(27);
+
+  adc_select_input(0); // O round-robin começa no eixo Y
+  adc_set_round_robin(0x3);
+  adc_fifo_setup(true, true, 1, false, false); // FIFO + DREQ, amostras de 12 bits
+  adc_set_clkdiv(48000000.f / JOYSTICK_SAMPLE_HZ - 1); // clk_adc de 48 MHz
+
+  for (uint i = 0; i < 2; ++i)
+    dma_chan[i] = dma_claim_unused_channel(true);
+
+  for (uint i = 0; i < 2; ++i) {
+    dma_channel_config c = dma_channel_get_default_config(dma_chan[i]);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, __builtin_ctz(sizeof(ring))); // Escrita volta ao início do anel
+    channel_config_set_dreq(&c, DREQ_ADC);
+    channel_config_set_chain_to(&c, dma_chan[i ^ 1]);
+    dma_channel_configure(dma_chan[i], &c, ring, &adc_hw->fifo, JOYSTICK_RING_LEN, false);
+  }
+
+  dma_channel_start(dma_chan[0]);
+  adc_run(true);
+}
+
+// Roda no boot, com o joystick solto: o centro de cada eixo passa a ser a
+// média de algumas voltas do anel
+void joystick_calibrate(void) {
+  uint32_t window_ms = JOYSTICK_RING_LEN * 1000 / JOYSTICK_SAMPLE_HZ + 1;
+  uint32_t sum_x = 0, sum_y = 0;
+
+  sleep_ms(window_ms); // Anel cheio
+  for (uint i = 0; i < 8; ++i) {
+    uint16_t x, y;
+    joystick_read_raw(&x, &y);
+    sum_x += x;
+    sum_y += y;
+    sleep_ms(window_ms);
+  }
+
+  // Um eixo muito fora do nominal indica o joystick segurado no boot
+  center_x = sum_x / 8;
+  center_y = sum_y / 8;
+  if (abs((int)center_x - JOYSTICK_CENTER) > JOYSTICK_CENTER_TOLERANCE)
+    center_x = JOYSTICK_CENTER;
+  if (abs((int)center_y - JOYSTICK_CENTER) > JOYSTICK_CENTER_TOLERANCE)
+    center_y = JOYSTICK_CENTER;
+}
+
+void joystick_set_deadzone(uint16_t value) {
+  deadzone = value;
+}
+
+// Média (boxcar) de todas as amostras de cada eixo no anel
+void joystick_read_raw(uint16_t *x, uint16_t *y) {
+  uint32_t sum_x = 0, sum_y = 0;
+  for (uint i = 0; i < JOYSTICK_RING_LEN; i += 2) {
+    sum_y += ring[i];
+    sum_x += ring[i + 1];
+  }
+  *x = sum_x / (JOYSTICK_RING_LEN / 2);
+  *y = sum_y / (JOYSTICK_RING_LEN / 2);
+}
+
+// Posição filtrada em relação ao centro calibrado; 0 dentro da zona morta
+void joystick_read(int16_t *x, int16_t *y) {
+  uint16_t raw_x, raw_y;
+  joystick_read_raw(&raw_x, &raw_y);
+
+  int16_t dx = (int16_t)raw_x - (int16_t)center_x;
+  int16_t dy = (int16_t)raw_y - (int16_t)center_y;
+  *x = abs(dx) > deadzone ? dx : 0;
+  *y = abs(dy) > deadzone ? dy : 0;
+
+#if TRACE_ENABLED
+  // Só a mudança de direção é registrada; o valor varia a cada leitura
+  static int8_t last_sx, last_sy;
+  int8_t sx = (*x > 0) - (*x < 0), sy = (*y > 0) - (*y < 0);
+  if (sx != last_sx || sy != last_sy) {
+    TRACE(TRACE_JOYSTICK, (uint32_t)(uint16_t)*x << 16 | (uint16_t)*y);
+    last_sx = sx;
+    last_sy = sy;
+  }
+#endif
+}
@@ -0,0 +1,19 @@
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include "pico/stdlib.h"
+
+// Eixos nas entradas 0 (GPIO 26, Y) e 1 (GPIO 27, X) do ADC
+#define JOYSTICK_RING_LEN 32          // Amostras no anel (pares Y/X); potência de 2
+#define JOYSTICK_SAMPLE_HZ 4000       // Conversões por segundo, somando os dois eixos
+#define JOYSTICK_CENTER 2048          // Centro nominal (ADC de 12 bits)
+#define JOYSTICK_CENTER_TOLERANCE 400 // Calibração mais longe do nominal é descartada
+#define JOYSTICK_DEADZONE 100
+
+void joystick_init(void);
+void joystick_calibrate(void);
+void joystick_set_deadzone(uint16_t deadzone);
+void joystick_read_raw(uint16_t *x, uint16_t *y);
+void joystick_read(int16_t *x, int16_t *y);
+
+#endif
@@ -0,0 +1,319 @@
+#include "kvlog.h"
+#include <stddef.h>
+#include <string.h>
+#include "pico/flash.h"
+#include "sched.h"
+
+#define KVLOG_SLOTS (FLASH_SECTOR_SIZE / KVLOG_SLOT_SIZE)
+#define KVLOG_SLOTS_PER_PAGE (FLASH_PAGE_SIZE / KVLOG_SLOT_SIZE)
+#define KVLOG_KEY_HEADER 0xFE
+#define KVLOG_MAGIC 0x4B564C31 // "KVL1"
+#define KVLOG_TIMEOUT_MS 10    // Espera pelo núcleo 1 antes de desistir da operação
+
+typedef struct {
+  uint8_t key;
+  uint8_t len;
+  uint16_t reserved;
+  uint8_t value[KVLOG_VALUE_MAX];
+  uint32_t crc; // CRC-32 dos 28 bytes anteriores
+} kvlog_slot_t;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t seq;
+} kvlog_header_t;
+
+// Etapas da compactação, uma operação na flash por volta do agendador
+typedef enum {
+  COMPACT_IDLE,
+  COMPACT_ERASE,   // Apagar o próximo setor do anel
+  COMPACT_COPY,    // Gravar a cópia das chaves (cabeçalho ainda apagado)
+  COMPACT_HEADER,  // Gravar o cabeçalho: a partir daqui o setor novo vale
+} kvlog_compact_t;
+
+static kvlog_ready_t ready;
+static kvlog_stats_t stats;
+
+// Último valor de cada chave; `dirty` são as que ainda não estão na flash
+static uint8_t values[KVLOG_MAX_KEYS][KVLOG_VALUE_MAX];
+static uint8_t lengths[KVLOG_MAX_KEYS];
+static uint8_t present, dirty;
+
+static int active = -1;     // Setor ativo (-1 = nenhum válido)
+static uint32_t active_seq;
+static uint write_slot;      // Próximo slot livre do setor ativo
+static kvlog_compact_t compact;
+static uint copied_slots;    // Slots ocupados pela cópia no setor novo
+
+static uint8_t page[FLASH_PAGE_SIZE];
+
+static uint32_t fail_streak;
+static uint64_t retry_at;    // Antes disso o poll não tenta de novo
+
+static const kvlog_slot_t *slot_at(uint sector, uint slot) {
+  return (const kvlog_slot_t *)(XIP_BASE + KVLOG_OFFSET + sector * FLASH_SECTOR_SIZE + slot * KVLOG_SLOT_SIZE);
+}
+
+// CRC-32 (polinômio refletido 0xEDB88320), tabela de 16 entradas
+static uint32_t kvlog_crc(const uint8_t *data, size_t len) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; ++i) {
+    crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+static bool slot_valid(const kvlog_slot_t *slot) {
+  return slot->len <= KVLOG_VALUE_MAX && slot->crc == kvlog_crc((const uint8_t *)slot, offsetof(kvlog_slot_t, crc));
+}
+
+static bool slot_erased(const kvlog_slot_t *slot) {
+  const uint32_t *words = (const uint32_t *)slot;
+  for (uint i = 0; i < KVLOG_SLOT_SIZE / 4; ++i) {
+    if (words[i] != 0xFFFFFFFF)
+      return false;
+  }
+  return true;
+}
+
+static void slot_fill(kvlog_slot_t *slot, uint8_t key, const void *value, uint8_t len) {
+  memset(slot, 0xFF, sizeof(*slot));
+  slot->key = key;
+  slot->len = len;
+  memcpy(slot->value, value, len);
+  slot->crc = kvlog_crc((const uint8_t *)slot, offsetof(kvlog_slot_t, crc));
+}
+
+// --- Operações na flash (com o outro núcleo parado e IRQs desligadas) ---
+
+typedef struct {
+  uint32_t offset;
+  bool erase;
+} kvlog_op_t;
+
+static void kvlog_flash_op(void *param) {
+  const kvlog_op_t *op = param;
+  if (op->erase)
+    flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+  else
+    flash_range_program(op->offset, page, FLASH_PAGE_SIZE);
+}
+
+// Fim da espera depois de uma falha: o agendador pode estar dormindo
+static int64_t kvlog_retry_alarm(alarm_id_t id, void *user_data) {
+  sched_wake();
+  return 0;
+}
+
+static bool kvlog_run(uint32_t offset, bool erase) {
+  kvlog_op_t op = { KVLOG_OFFSET + offset, erase };
+  uint32_t start = time_us_32();
+  bool ok = flash_safe_execute(kvlog_flash_op, &op, KVLOG_TIMEOUT_MS) == PICO_OK;
+  uint32_t elapsed = time_us_32() - start;
+  if (elapsed > stats.op_max_us)
+    stats.op_max_us = elapsed;
+  if (ok) {
+    fail_streak = 0;
+    return true;
+  }
+  // Cada tentativa desliga as IRQs e para o núcleo 1: espera cada vez mais
+  // antes da próxima, em vez de tentar a cada volta do agendador
+  stats.failures++;
+  uint32_t shift = fail_streak < KVLOG_RETRY_SHIFT_MAX ? fail_streak : KVLOG_RETRY_SHIFT_MAX;
+  uint32_t wait_us = KVLOG_RETRY_US << shift;
+  fail_streak++;
+  retry_at = time_us_64() + wait_us;
+  add_alarm_in_us(wait_us, kvlog_retry_alarm, NULL, true);
+  return false;
+}
+
+// --- Recuperação ---
+
+static bool header_read(uint sector, uint32_t *seq) {
+  const kvlog_slot_t *slot = slot_at(sector, 0);
+  if (slot->key != KVLOG_KEY_HEADER || !slot_valid(slot))
+    return false;
+  kvlog_header_t header;
+  memcpy(&header, slot->value, sizeof(header));
+  if (header.magic != KVLOG_MAGIC)
+    return false;
+  *seq = header.seq;
+  return true;
+}
+
+// Lê os cabeçalhos e só o setor mais novo: o custo não cresce com o histórico
+static void kvlog_recover(void) {
+  active = -1;
+  for (uint s = 0; s < KVLOG_SECTORS; ++s) {
+    uint32_t seq;
+    if (header_read(s, &seq) && (active < 0 || (int32_t)(seq - active_seq) > 0)) {
+      active = s;
+      active_seq = seq;
+    }
+  }
+  present = dirty = 0;
+  write_slot = KVLOG_SLOTS;
+  if (active < 0)
+    return;
+
+  for (write_slot = 1; write_slot < KVLOG_SLOTS; ++write_slot) {
+    const kvlog_slot_t *slot = slot_at(active, write_slot);
+    if (slot_erased(slot))
+      break;
+    if (slot->key >= KVLOG_MAX_KEYS || !slot_valid(slot)) {
+      stats.crc_errors++; // Slot gasto por uma gravação interrompida
+      continue;
+    }
+    memcpy(values[slot->key], slot->value, slot->len);
+    lengths[slot->key] = slot->len;
+    present |= 1u << slot->key;
+  }
+}
+
+// --- Gravação ---
+
+static uint dirty_count(void) {
+  uint n = 0;
+  for (uint8_t m = dirty; m; m &= m - 1)
+    n++;
+  return n;
+}
+
+// Grava as chaves pendentes que cabem na página do próximo slot livre
+static void kvlog_append(void) {
+  uint first = write_slot;
+  uint last = (first / KVLOG_SLOTS_PER_PAGE + 1) * KVLOG_SLOTS_PER_PAGE;
+  uint8_t written = 0;
+  memset(page, 0xFF, sizeof(page));
+  uint slot = first;
+  for (uint8_t key = 0; key < KVLOG_MAX_KEYS && slot < last; ++key) {
+    if (dirty & (1u << key)) {
+      slot_fill((kvlog_slot_t *)&page[(slot % KVLOG_SLOTS_PER_PAGE) * KVLOG_SLOT_SIZE], key, values[key], lengths[key]);
+      written |= 1u << key;
+      slot++;
+    }
+  }
+  uint32_t page_offset = active * FLASH_SECTOR_SIZE + (first / KVLOG_SLOTS_PER_PAGE) * FLASH_PAGE_SIZE;
+  if (!kvlog_run(page_offset, false))
+    return;
+  // Mesmo com falha de energia no meio, os slots gravados nunca são reaproveitados
+  write_slot = slot;
+  dirty &= ~written;
+  stats.appends++;
+}
+
+// Um passo da compactação para o próximo setor do anel
+static void kvlog_compact_step(void) {
+  uint next = active < 0 ? 0 : (active + 1) % KVLOG_SECTORS;
+  switch (compact) {
+  case COMPACT_IDLE:
+  case COMPACT_ERASE:
+    compact = COMPACT_ERASE;
+    if (kvlog_run(next * FLASH_SECTOR_SIZE, true)) {
+      stats.erases++;
+      compact = COMPACT_COPY;
+    }
+    break;
+  case COMPACT_COPY: {
+    // Todas as chaves, com os valores atuais; o que mudar depois fica pendente
+    memset(page, 0xFF, sizeof(page));
+    uint slot = 1;
+    for (uint8_t key = 0; key < KVLOG_MAX_KEYS; ++key) {
+      if (present & (1u << key))
+        slot_fill((kvlog_slot_t *)&page[slot++ * KVLOG_SLOT_SIZE], key, values[key], lengths[key]);
+    }
+    uint8_t copied = present;
+    if (kvlog_run(next * FLASH_SECTOR_SIZE, false)) {
+      dirty &= ~copied;
+      copied_slots = slot;
+      compact = COMPACT_HEADER;
+    }
+    break;
+  }
+  case COMPACT_HEADER: {
+    kvlog_header_t header = { KVLOG_MAGIC, active < 0 ? 1 : active_seq + 1 };
+    memset(page, 0xFF, sizeof(page));
+    slot_fill((kvlog_slot_t *)page, KVLOG_KEY_HEADER, &header, sizeof(header));
+    if (kvlog_run(next * FLASH_SECTOR_SIZE, false)) {
+      active = next;
+      active_seq = header.seq;
+      write_slot = copied_slots;
+      compact = COMPACT_IDLE;
+      stats.compactions++;
+    }
+    break;
+  }
+  }
+}
+
+// Poll do agendador: no máximo uma operação na flash por volta, e só quando
+// a aplicação libera e a espera de uma falha anterior já passou. Um
+// apagamento de setor é a operação mais longa.
+static bool kvlog_poll(void) {
+  if ((!dirty && compact == COMPACT_IDLE) || time_us_64() < retry_at)
+    return false;
+  bool compacting = compact != COMPACT_IDLE || write_slot + dirty_count() > KVLOG_SLOTS;
+  if (!ready(compacting && (compact == COMPACT_IDLE || compact == COMPACT_ERASE)))
+    return false;
+  if (compacting)
+    kvlog_compact_step();
+  else
+    kvlog_append();
+  return dirty != 0 || compact != COMPACT_IDLE;
+}
+
+void kvlog_init(kvlog_ready_t ready_cb) {
+  uint32_t start = time_us_32();
+  ready = ready_cb;
+  compact = COMPACT_IDLE;
+  kvlog_recover();
+  stats.boot_us = time_us_32() - start;
+  sched_add_poll(kvlog_poll);
+}
+
+// Copia o último valor salvo (até `len` bytes); false se a chave não existe
+bool kvlog_get(uint8_t key, void *value, size_t len) {
+  if (key >= KVLOG_MAX_KEYS || !(present & (1u << key)))
+    return false;
+  memset(value, 0, len);
+  memcpy(value, values[key], len < lengths[key] ? len : lengths[key]);
+  return true;
+}
+
+// Guarda o valor na RAM e agenda a gravação; valores iguais não gastam flash
+bool kvlog_set(uint8_t key, const void *value, size_t len) {
+  if (key >= KVLOG_MAX_KEYS || len > KVLOG_VALUE_MAX)
+    return false;
+  if ((present & (1u << key)) && lengths[key] == len && memcmp(values[key], value, len) == 0)
+    return true;
+  memcpy(values[key], value, len);
+  lengths[key] = len;
+  present |= 1u << key;
+  dirty |= 1u << key;
+  return true;
+}
+
+bool kvlog_pending(void) {
+  return dirty != 0;
+}
+
+// Muitas falhas seguidas: os valores continuam na RAM, mas podem não chegar
+// à flash. As tentativas continuam, na espera máxima.
+bool kvlog_failed(void) {
+  return fail_streak >= KVLOG_FAILED_STREAK;
+}
+
+void kvlog_get_stats(kvlog_stats_t *out, bool reset) {
+  *out = stats;
+  out->fail_streak = fail_streak;
+  if (reset) {
+    uint32_t boot_us = stats.boot_us;
+    stats = (kvlog_stats_t){0};
+    stats.boot_us = boot_us;
+  }
+}
@@ -0,0 +1,46 @@
+#ifndef KVLOG_H
+#define KVLOG_H
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+
+// Chave/valor persistente nos últimos setores da flash, em log só de
+// acréscimo. Cada registro ocupa um slot de 32 bytes com CRC; o setor ativo
+// começa com um cabeçalho numerado e com uma cópia de todas as chaves, então
+// o boot só lê os cabeçalhos e o setor ativo. Setor cheio: o próximo do anel
+// é apagado e recebe a cópia (compactação), o que espalha os apagamentos.
+#define KVLOG_SECTORS 4
+#define KVLOG_OFFSET (PICO_FLASH_SIZE_BYTES - KVLOG_SECTORS * FLASH_SECTOR_SIZE)
+#define KVLOG_SLOT_SIZE 32
+#define KVLOG_VALUE_MAX 24
+#define KVLOG_MAX_KEYS 7 // Cabeçalho + todas as chaves cabem na primeira página
+#define KVLOG_RETRY_US 50000      // Espera após uma operação que falhou, dobrando a cada falha seguida
+#define KVLOG_RETRY_SHIFT_MAX 6   // Espera máxima: 64 x KVLOG_RETRY_US (3,2 s)
+#define KVLOG_FAILED_STREAK 8     // Falhas seguidas para considerar a flash com defeito
+
+// Diz se a flash pode ser gravada agora. Durante a operação as IRQs do
+// núcleo 0 ficam desligadas, o núcleo 1 espera na RAM e a XIP some, então
+// nenhuma IRQ pode precisar ler a flash (ex.: o mixer dos clipes PCM).
+// `erase` indica um apagamento de setor, dezenas de ms com as IRQs
+// desligadas, contra cerca de 1 ms para gravar uma página.
+typedef bool (*kvlog_ready_t)(bool erase);
+
+typedef struct {
+  uint32_t appends;       // Páginas gravadas com registros novos
+  uint32_t compactions;
+  uint32_t erases;
+  uint32_t crc_errors;    // Slots descartados na recuperação (gravação interrompida)
+  uint32_t op_max_us;     // Maior operação na flash (tempo com as IRQs desligadas)
+  uint32_t boot_us;       // Recuperação no boot
+  uint32_t failures;      // Operações que não rodaram (o núcleo 1 não parou a tempo)
+  uint32_t fail_streak;   // Falhas seguidas até agora (não é zerado com o reset)
+} kvlog_stats_t;
+
+void kvlog_init(kvlog_ready_t ready);
+bool kvlog_get(uint8_t key, void *value, size_t len);
+bool kvlog_set(uint8_t key, const void *value, size_t len);
+bool kvlog_pending(void);
+bool kvlog_failed(void);
+void kvlog_get_stats(kvlog_stats_t *stats, bool reset);
+
+#endif
@@ -0,0 +1,88 @@
+#include "matrix.h"
+#include "ws2812.h"
+#include <string.h>
+
+// (x, y) lógico → posição no cabo. A matriz é ligada em serpentina a
+// partir do canto superior esquerdo: a linha de cima vai da esquerda para a
+// direita, a seguinte no sentido contrário, e assim por diante.
+static const uint8_t matrix_index[MATRIX_HEIGHT][MATRIX_WIDTH] = {
+  { 20, 21, 22, 23, 24 }, // y = 0 (linha de baixo)
+  { 19, 18, 17, 16, 15 },
+  { 10, 11, 12, 13, 14 },
+  {  9,  8,  7,  6,  5 },
+  {  0,  1,  2,  3,  4 }, // y = 4 (linha de cima)
+};
+
+// Correção gama 2.2: intensidade percebida → valor enviado ao LED
+static const uint8_t matrix_gamma[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+    3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+    6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+   12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+   20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+   30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+   42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+   56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+   73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+   91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+  113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+  137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+  163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+  192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+  223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+static uint8_t layers[MATRIX_LAYERS][MATRIX_LEDS][3]; // {R, G, B} na ordem do cabo
+static uint8_t brightness = MATRIX_BRIGHTNESS_DEFAULT;
+static uint8_t lut[256];
+static bool lut_valid;
+
+// Limite global de brilho (0–255), aplicado sobre a curva gama
+void matrix_set_brightness(uint8_t cap) {
+  brightness = cap;
+  lut_valid = false;
+}
+
+void matrix_clear(uint8_t layer) {
+  memset(layers[layer], 0, sizeof(layers[layer]));
+}
+
+void matrix_fill(uint8_t layer, uint8_t r, uint8_t g, uint8_t b) {
+  for (uint8_t i = 0; i < MATRIX_LEDS; ++i) {
+    layers[layer][i][0] = r;
+    layers[layer][i][1] = g;
+    layers[layer][i][2] = b;
+  }
+}
+
+void matrix_set(uint8_t layer, int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+  if (x < 0 || x >= MATRIX_WIDTH || y < 0 || y >= MATRIX_HEIGHT)
+    return;
+  uint8_t *led = layers[layer][matrix_index[y][x]];
+  led[0] = r;
+  led[1] = g;
+  led[2] = b;
+}
+
+// Soma as camadas (saturando em 255) e converte pela tabela de gama/brilho
+// para as palavras GRB enviadas aos LEDs
+void matrix_compose(uint32_t *grb) {
+  if (!lut_valid) {
+    for (int i = 0; i < 256; ++i)
+      lut[i] = (matrix_gamma[i] * brightness + 127) / 255;
+    lut_valid = true;
+  }
+
+  for (uint8_t i = 0; i < MATRIX_LEDS; ++i) {
+    uint16_t rgb[3] = {0, 0, 0};
+    for (uint8_t l = 0; l < MATRIX_LAYERS; ++l) {
+      rgb[0] += layers[l][i][0];
+      rgb[1] += layers[l][i][1];
+      rgb[2] += layers[l][i][2];
+    }
+    grb[i] = ws2812_rgb(lut[rgb[0] > 255 ? 255 : rgb[0]],
+                        lut[rgb[1] > 255 ? 255 : rgb[1]],
+                        lut[rgb[2] > 255 ? 255 : rgb[2]]);
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include "pico/stdlib.h"
+
+#define MATRIX_WIDTH 5
+#define MATRIX_HEIGHT 5
+#define MATRIX_LEDS (MATRIX_WIDTH * MATRIX_HEIGHT)
+#define MATRIX_LAYERS 3
+#define MATRIX_BRIGHTNESS_DEFAULT 64 // Pior caso (tudo branco) ~25 × 60 mA × 64/255 ≈ 380 mA
+
+// Camadas de desenho em coordenadas lógicas: x da esquerda para a direita,
+// y de baixo para cima. As camadas são somadas com saturação na composição.
+void matrix_set_brightness(uint8_t cap);
+void matrix_clear(uint8_t layer);
+void matrix_fill(uint8_t layer, uint8_t r, uint8_t g, uint8_t b);
+void matrix_set(uint8_t layer, int x, int y, uint8_t r, uint8_t g, uint8_t b);
+void matrix_compose(uint32_t *grb);
+
+#endif
@@ -0,0 +1,314 @@
+#include "output.h"
+#include <string.h>
+#include "sched.h"
+#include "ws2812.h"
+#include "hardware/sync.h"
+#include "trace.h"
+#if OUTPUT_MULTICORE
+#include "pico/multicore.h"
+#include "pico/flash.h"
+#include "hardware/structs/scb.h"
+#endif
+
+// Saídas (display, matriz de LEDs e buzzer). No modo multicore só o núcleo 1
+// toca nesses dispositivos e no estado de `display`/telas; o núcleo 0 envia
+// comandos por um anel SPSC (produtor: núcleo 0, consumidor: núcleo 1).
+
+static ssd1306_t *display;
+static scroller_t scroller;
+static output_stats_t stats;
+
+// Último quadro recebido; fica aqui enquanto o anterior ainda está saindo
+static uint32_t matrix_pending[OUTPUT_MATRIX_LEDS];
+static bool matrix_dirty;
+static volatile uint32_t *matrix_stamp; // Pedido de instante de travamento ainda não enviado
+static bool display_off;
+
+static bool output_flush_pending(void);
+
+static void output_execute(const output_msg_t *msg) {
+  TRACE(TRACE_OUTPUT_CMD, msg->cmd);
+  switch (msg->cmd) {
+  case OUTPUT_SCREEN:
+    screen_show(display, msg->screen.screen, msg->screen.has_values ? msg->screen.values : NULL);
+    ssd1306_send_data_async(display);
+    break;
+  case OUTPUT_MATRIX:
+    memcpy(matrix_pending, msg->matrix.grb, sizeof(matrix_pending));
+    matrix_dirty = true;
+    // Um quadro posterior substitui o marcado, mas ainda contém o que ele mostrava
+    if (msg->matrix.latched_us)
+      matrix_stamp = msg->matrix.latched_us;
+    output_flush_pending();
+    break;
+  case OUTPUT_BUZZER:
+    // Tons e PCM dividem o mesmo slice do PWM: um interrompe o outro
+    pcm_stop();
+    if (msg->buzzer.melody) {
+      buzzer_play(msg->buzzer.melody);
+    } else {
+      buzzer_stop();
+      uint32_t latency = time_us_32() - msg->buzzer.requested_us;
+      if (latency > stats.buzzer_stop_max_us)
+        stats.buzzer_stop_max_us = latency;
+    }
+    break;
+  case OUTPUT_SOUND:
+    if (buzzer_playing())
+      buzzer_stop();
+    pcm_play(msg->clip); // Sem voz livre, o clipe é descartado
+    break;
+  case OUTPUT_DISPLAY:
+    // Contraste antes de acender, para a tela não piscar no brilho antigo
+    if (msg->display.on)
+      ssd1306_set_contrast(display, msg->display.contrast);
+    ssd1306_set_power(display, msg->display.on);
+    display_off = !msg->display.on;
+    break;
+  case OUTPUT_SCROLL:
+    switch (msg->scroll.op) {
+    case OUTPUT_SCROLL_START:
+      screen_invalidate(); // O texto rolando substitui a tela em ram_buffer
+      scroller_start(&scroller, display, msg->scroll.lines, msg->scroll.count, msg->scroll.value);
+      break;
+    case OUTPUT_SCROLL_STEP:
+      scroller_step(&scroller);
+      break;
+    case OUTPUT_SCROLL_VALUE:
+      scroller_set_value(&scroller, msg->scroll.value);
+      break;
+    case OUTPUT_SCROLL_STOP:
+      scroller_stop(&scroller);
+      break;
+    }
+    // Na maioria dos passos só a start line muda e não há o que enviar
+    if (display->dirty)
+      ssd1306_send_data_async(display);
+    break;
+  }
+}
+
+// Reenvia o que ficou pendente enquanto o DMA estava ocupado. Quadros da
+// matriz que chegam durante um envio são agrupados: só o último é mostrado.
+static bool output_flush_pending(void) {
+  if (display->dirty && !ssd1306_flush_busy(display))
+    ssd1306_send_data_async(display);
+  if (matrix_dirty && ws2812_show_stamped(matrix_pending, OUTPUT_MATRIX_LEDS, matrix_stamp)) {
+    matrix_dirty = false;
+    matrix_stamp = NULL;
+  }
+  return false;
+}
+
+#if OUTPUT_MULTICORE
+
+#define OUTPUT_READY 0x5A1DA
+
+static output_msg_t ring[OUTPUT_QUEUE_LEN];
+static volatile uint8_t ring_head; // Escrito só pelo núcleo 0
+static volatile uint8_t ring_tail; // Escrito só pelo núcleo 1
+static void (*output_setup)(void);
+// Cada núcleo só escreve os próprios contadores: o núcleo 0 pede o reset
+// dos do núcleo 1 incrementando `stats_resets`, e o núcleo 1 os zera
+static volatile uint32_t stats_resets;
+static uint32_t stats_resets_seen;
+
+// Fim de quadro da matriz (IRQ do alarme da matriz, no próprio núcleo 1):
+// garante que o __wfe() do laço volte para enviar o quadro pendente
+static void output_wake_core1(void) {
+  __sev();
+}
+
+static void output_core1(void) {
+  flash_safe_execute_core_init(); // O núcleo 0 grava a flash (src/kvlog.c) com este parado
+  output_setup();
+  multicore_fifo_push_blocking(OUTPUT_READY);
+
+  while (true) {
+    if (stats_resets != stats_resets_seen) {
+      stats_resets_seen = stats_resets;
+      stats.core1_busy_us = 0;
+      stats.buzzer_stop_max_us = 0;
+    }
+    while (ring_tail != ring_head) {
+      uint8_t tail = ring_tail;
+      __mem_fence_acquire();
+      uint32_t start = time_us_32();
+      output_execute(&ring[tail]);
+      stats.core1_busy_us += time_us_32() - start;
+      __mem_fence_release();
+      ring_tail = (tail + 1) & (OUTPUT_QUEUE_LEN - 1);
+    }
+    output_flush_pending();
+
+    // O __sev() do núcleo 0, do fim do quadro da matriz ou a IRQ do fim do
+    // envio do display acordam o núcleo;
+    // um evento sinalizado antes do __wfe() faz ele retornar na hora.
+    // Com a tela desligada (POWER_OFF, src/power.c) o sono é profundo, para
+    // os clocks cortados valerem enquanto o núcleo 0 também dorme.
+    if (ring_tail == ring_head) {
+      if (display_off)
+        scb_hw->scr |= M0PLUS_SCR_SLEEPDEEP_BITS;
+      __wfe();
+      scb_hw->scr &= ~M0PLUS_SCR_SLEEPDEEP_BITS;
+    }
+  }
+}
+
+// Reserva a próxima posição do anel, esperando o núcleo 1 se estiver cheio
+static output_msg_t *output_begin(uint8_t cmd) {
+  uint8_t next = (ring_head + 1) & (OUTPUT_QUEUE_LEN - 1);
+  if (next == ring_tail) {
+    stats.stalls++;
+    while (next == ring_tail)
+      tight_loop_contents();
+  }
+  __mem_fence_acquire();
+  output_msg_t *msg = &ring[ring_head];
+  msg->cmd = cmd;
+  return msg;
+}
+
+static void output_commit(output_msg_t *msg) {
+  __mem_fence_release();
+  ring_head = (ring_head + 1) & (OUTPUT_QUEUE_LEN - 1);
+  __sev();
+}
+
+void output_init(ssd1306_t *ssd, void (*setup)(void)) {
+  display = ssd;
+  ring_head = ring_tail = 0;
+  output_setup = setup;
+  ws2812_set_done_callback(output_wake_core1);
+  multicore_launch_core1(output_core1);
+  multicore_fifo_pop_blocking(); // Aguarda o setup no núcleo 1
+}
+
+#else
+
+static output_msg_t scratch;
+
+static output_msg_t *output_begin(uint8_t cmd) {
+  scratch.cmd = cmd;
+  return &scratch;
+}
+
+static void output_commit(output_msg_t *msg) {
+  uint32_t start = time_us_32();
+  output_execute(msg);
+  stats.core1_busy_us += time_us_32() - start; // Mesmo núcleo, mas mantém a métrica comparável
+}
+
+void output_init(ssd1306_t *ssd, void (*setup)(void)) {
+  display = ssd;
+  ws2812_set_done_callback(sched_wake);
+  setup();
+  sched_add_poll(output_flush_pending);
+}
+
+#endif
+
+static void output_account(uint32_t start) {
+  uint32_t elapsed = time_us_32() - start;
+  stats.messages++;
+  stats.core0_us += elapsed;
+  if (elapsed > stats.core0_max_us)
+    stats.core0_max_us = elapsed;
+}
+
+void output_screen(screen_t *screen, const int *values) {
+  uint32_t start = time_us_32();
+  output_msg_t *msg = output_begin(OUTPUT_SCREEN);
+  msg->screen.screen = screen;
+  msg->screen.has_values = values != NULL;
+  for (uint8_t i = 0; values && i < screen->field_count && i < SCREEN_MAX_FIELDS; ++i)
+    msg->screen.values[i] = values[i];
+  output_commit(msg);
+  output_account(start);
+}
+
+void output_matrix(const uint32_t *grb) {
+  output_matrix_stamped(grb, NULL);
+}
+
+// Envia o quadro e, quando ele travar nos LEDs, grava time_us_32() em
+// `latched_us` (na IRQ do alarme da matriz)
+void output_matrix_stamped(const uint32_t *grb, volatile uint32_t *latched_us) {
+  uint32_t start = time_us_32();
+  output_msg_t *msg = output_begin(OUTPUT_MATRIX);
+  memcpy(msg->matrix.grb, grb, sizeof(msg->matrix.grb));
+  msg->matrix.latched_us = latched_us;
+  output_commit(msg);
+  output_account(start);
+}
+
+// Toca a melodia (ou para o buzzer, com NULL) no núcleo de saída
+void output_buzzer(const buzzer_melody_t *melody) {
+  uint32_t start = time_us_32();
+  output_msg_t *msg = output_begin(OUTPUT_BUZZER);
+  msg->buzzer.melody = melody;
+  msg->buzzer.requested_us = start;
+  output_commit(msg);
+  output_account(start);
+}
+
+// Toca um clipe PCM, misturado com o que já estiver tocando
+void output_sound(const pcm_clip_t *clip) {
+  uint32_t start = time_us_32();
+  output_msg_t *msg = output_begin(OUTPUT_SOUND);
+  msg->clip = clip;
+  output_commit(msg);
+  output_account(start);
+}
+
+// Liga (com o contraste dado) ou desliga o display, sem mexer na GDDRAM
+void output_display(bool on, uint8_t contrast) {
+  uint32_t start = time_us_32();
+  output_msg_t *msg = output_begin(OUTPUT_DISPLAY);
+  msg->display.on = on;
+  msg->display.contrast = contrast;
+  output_commit(msg);
+  output_account(start);
+}
+
+static void output_scroll(uint8_t op, const char *const *lines, uint8_t count, int value) {
+  uint32_t start = time_us_32();
+  output_msg_t *msg = output_begin(OUTPUT_SCROLL);
+  msg->scroll.op = op;
+  msg->scroll.lines = lines;
+  msg->scroll.count = count;
+  msg->scroll.value = value;
+  output_commit(msg);
+  output_account(start);
+}
+
+// Texto em laço rolando na tela inteira (src/scroller.h), um passo por
+// output_scroll_step(); uma linha pode mostrar `value` com %d
+void output_scroll_start(const char *const *lines, uint8_t count, int value) {
+  output_scroll(OUTPUT_SCROLL_START, lines, count, value);
+}
+
+void output_scroll_step(void) {
+  output_scroll(OUTPUT_SCROLL_STEP, NULL, 0, 0);
+}
+
+void output_scroll_value(int value) {
+  output_scroll(OUTPUT_SCROLL_VALUE, NULL, 0, value);
+}
+
+void output_scroll_stop(void) {
+  output_scroll(OUTPUT_SCROLL_STOP, NULL, 0, 0);
+}
+
+void output_get_stats(output_stats_t *out, bool reset) {
+  *out = stats;
+  if (!reset)
+    return;
+  stats.messages = stats.stalls = stats.core0_us = stats.core0_max_us = 0;
+#if OUTPUT_MULTICORE
+  stats_resets++;
+  __sev();
+#else
+  stats.core1_busy_us = stats.buzzer_stop_max_us = 0;
+#endif
+}
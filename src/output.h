@@ -0,0 +1,92 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+#include "screen.h"
+#include "buzzer.h"
+#include "pcm.h"
+#include "scroller.h"
+
+// 1: o núcleo 1 é dono do display, da matriz e do buzzer e recebe comandos
+// do núcleo 0 por uma fila. 0: os comandos são executados na hora, no núcleo 0.
+#ifndef OUTPUT_MULTICORE
+#define OUTPUT_MULTICORE 1
+#endif
+
+#define OUTPUT_QUEUE_LEN 8   // Potência de 2
+#define OUTPUT_MATRIX_LEDS 25
+
+typedef enum {
+  OUTPUT_SCREEN,
+  OUTPUT_MATRIX,
+  OUTPUT_BUZZER,
+  OUTPUT_SOUND,
+  OUTPUT_DISPLAY,
+  OUTPUT_SCROLL,
+} output_cmd_t;
+
+typedef enum {
+  OUTPUT_SCROLL_START,
+  OUTPUT_SCROLL_STEP,
+  OUTPUT_SCROLL_VALUE,
+  OUTPUT_SCROLL_STOP,
+} output_scroll_op_t;
+
+typedef struct {
+  uint8_t cmd;
+  union {
+    struct {
+      screen_t *screen;
+      int values[SCREEN_MAX_FIELDS];
+      bool has_values;
+    } screen;
+    struct {
+      uint32_t grb[OUTPUT_MATRIX_LEDS];    // Cores ws2812_rgb na ordem do cabo
+      volatile uint32_t *latched_us;       // Recebe o instante em que o quadro travar (ou NULL)
+    } matrix;
+    struct {
+      const buzzer_melody_t *melody;       // NULL = parar
+      uint32_t requested_us;               // Instante do pedido (latência de parada)
+    } buzzer;
+    const pcm_clip_t *clip;                // Clipe PCM para o mixer
+    struct {
+      bool on;
+      uint8_t contrast;                    // Usado só ao ligar
+    } display;
+    struct {
+      uint8_t op;                          // output_scroll_op_t
+      uint8_t count;
+      const char *const *lines;
+      int value;
+    } scroll;
+  };
+} output_msg_t;
+
+typedef struct {
+  uint32_t messages;
+  uint32_t stalls;          // Vezes em que o núcleo 0 esperou por espaço na fila
+  uint32_t core0_us;        // Tempo gasto pelo núcleo 0 nas chamadas output_*
+  uint32_t core0_max_us;
+  uint32_t core1_busy_us;   // Tempo do núcleo 1 executando comandos
+  uint32_t buzzer_stop_max_us; // Do pedido no núcleo 0 ao buzzer em silêncio
+} output_stats_t;
+
+// `setup` inicializa os dispositivos de saída e roda no núcleo que vai ser
+// dono deles (as IRQs do display e os alarm pools do buzzer e da matriz
+// ficam nesse núcleo). Retorna após o setup.
+void output_init(ssd1306_t *ssd, void (*setup)(void));
+
+void output_screen(screen_t *screen, const int *values);
+void output_matrix(const uint32_t *grb);
+void output_matrix_stamped(const uint32_t *grb, volatile uint32_t *latched_us);
+void output_buzzer(const buzzer_melody_t *melody);
+void output_sound(const pcm_clip_t *clip);
+void output_display(bool on, uint8_t contrast);
+void output_scroll_start(const char *const *lines, uint8_t count, int value);
+void output_scroll_step(void);
+void output_scroll_value(int value);
+void output_scroll_stop(void);
+void output_get_stats(output_stats_t *stats, bool reset);
+
+#endif
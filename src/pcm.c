@@ -0,0 +1,161 @@
+#include "pcm.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+
+// Reprodução de PCM no pino do buzzer. O PWM roda com wrap 255 (portadora de
+// ~488 kHz) e um timer do DMA, na taxa de amostragem, paceia a escrita de
+// cada amostra no registrador de comparação do slice. Dois canais de DMA
+// encadeados tocam as duas metades de um buffer duplo; quando uma metade
+// termina, a IRQ mistura as vozes nela a partir dos clipes na flash enquanto
+// a outra toca. Assim clipes de qualquer tamanho tocam sem ocupar RAM.
+
+static uint pcm_slice;
+static uint pcm_channel;    // Canal do slice (A/B) ligado ao pino
+static int dma_chan[2];
+static int dma_timer;
+static uint32_t blocks[2][PCM_BLOCK_SAMPLES];
+
+typedef struct {
+  const uint8_t *samples;
+  uint32_t remaining;
+} pcm_voice_t;
+
+static pcm_voice_t voices[PCM_VOICES];
+static volatile bool running;
+static int8_t final_block = -1; // Metade com o fim do som; ao terminar, para
+
+// Soma as vozes (com sinal em torno de 128, saturando) em uma metade do buffer
+static bool pcm_mix(uint32_t *block) {
+  bool active = false;
+  uint shift = pcm_channel ? 16 : 0;
+
+  for (uint i = 0; i < PCM_BLOCK_SAMPLES; ++i) {
+    int32_t sum = 0;
+    for (uint v = 0; v < PCM_VOICES; ++v) {
+      if (voices[v].remaining) {
+        sum += (int32_t)*voices[v].samples++ - 128;
+        voices[v].remaining--;
+      }
+    }
+    if (sum < -128)
+      sum = -128;
+    if (sum > 127)
+      sum = 127;
+    block[i] = (uint32_t)(sum + 128) << shift;
+  }
+
+  for (uint v = 0; v < PCM_VOICES; ++v)
+    active |= voices[v].remaining != 0;
+  return active;
+}
+
+static void pcm_halt(void) {
+  // Tira o EN dos dois canais antes do abort, senão o canal abortado ainda
+  // pode disparar o encadeado (errata RP2040-E13)
+  for (uint i = 0; i < 2; ++i)
+    hw_clear_bits(&dma_hw->ch[dma_chan[i]].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+  dma_hw->abort = (1u << dma_chan[0]) | (1u << dma_chan[1]);
+  while (dma_hw->abort)
+    tight_loop_contents();
+  dma_hw->ints1 = (1u << dma_chan[0]) | (1u << dma_chan[1]);
+
+  pwm_set_chan_level(pcm_slice, pcm_channel, 0);
+  running = false;
+  final_block = -1;
+}
+
+static void pcm_dma_irq(void) {
+  for (uint i = 0; i < 2; ++i) {
+    uint mask = 1u << dma_chan[i];
+    if (!(dma_hw->ints1 & mask))
+      continue;
+    dma_hw->ints1 = mask;
+
+    if (final_block == (int8_t)i) {
+      pcm_halt();
+      return;
+    }
+
+    // Esta metade acabou e a outra já está tocando: recarrega esta
+    if (!pcm_mix(blocks[i]) && final_block < 0)
+      final_block = i;
+    dma_channel_set_read_addr(dma_chan[i], blocks[i], false);
+  }
+}
+
+// Roda no núcleo dono do buzzer, depois de pwm_init_buzzer()
+void pcm_init(uint pin) {
+  pcm_slice = pwm_gpio_to_slice_num(pin);
+  pcm_channel = pwm_gpio_to_channel(pin);
+
+  // Timer do DMA na taxa de amostragem: clk_sys × 1 / (clk_sys / taxa)
+  dma_timer = dma_claim_unused_timer(true);
+  dma_timer_set_fraction(dma_timer, 1, clock_get_hz(clk_sys) / PCM_SAMPLE_RATE);
+
+  for (uint i = 0; i < 2; ++i)
+    dma_chan[i] = dma_claim_unused_channel(true);
+
+  for (uint i = 0; i < 2; ++i) {
+    dma_channel_config c = dma_channel_get_default_config(dma_chan[i]);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, dma_get_timer_dreq(dma_timer));
+    channel_config_set_chain_to(&c, dma_chan[i ^ 1]);
+    dma_channel_configure(dma_chan[i], &c, &pwm_hw->slice[pcm_slice].cc, blocks[i], PCM_BLOCK_SAMPLES, false);
+    dma_irqn_set_channel_enabled(1, dma_chan[i], true);
+  }
+
+  irq_add_shared_handler(DMA_IRQ_1, pcm_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+}
+
+// Coloca o clipe em uma voz livre; se nada estava tocando, prepara as duas
+// metades e inicia o DMA. Retorna false se todas as vozes estão ocupadas.
+bool pcm_play(const pcm_clip_t *clip) {
+  uint32_t status = save_and_disable_interrupts();
+  bool ok = false;
+  for (uint v = 0; v < PCM_VOICES && !ok; ++v) {
+    if (!voices[v].remaining) {
+      voices[v] = (pcm_voice_t){ clip->samples, clip->length };
+      ok = true;
+    }
+  }
+
+  if (ok && running) {
+    final_block = -1; // A nova voz entra na próxima metade recarregada
+  } else if (ok) {
+    // O PWM pode estar configurado para um tom do sequenciador
+    pwm_set_clkdiv_int_frac(pcm_slice, 1, 0);
+    pwm_set_wrap(pcm_slice, 255);
+
+    final_block = -1;
+    for (uint i = 0; i < 2; ++i) {
+      if (!pcm_mix(blocks[i]) && final_block < 0)
+        final_block = i;
+      dma_channel_set_read_addr(dma_chan[i], blocks[i], false);
+      dma_channel_set_trans_count(dma_chan[i], PCM_BLOCK_SAMPLES, false);
+      hw_set_bits(&dma_hw->ch[dma_chan[i]].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    }
+    running = true;
+    dma_channel_start(dma_chan[0]);
+  }
+  restore_interrupts(status);
+  return ok;
+}
+
+void pcm_stop(void) {
+  uint32_t status = save_and_disable_interrupts();
+  for (uint v = 0; v < PCM_VOICES; ++v)
+    voices[v].remaining = 0;
+  if (running)
+    pcm_halt();
+  restore_interrupts(status);
+}
+
+bool pcm_playing(void) {
+  return running;
+}
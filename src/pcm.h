@@ -0,0 +1,21 @@
+#ifndef PCM_H
+#define PCM_H
+
+#include "pico/stdlib.h"
+
+#define PCM_SAMPLE_RATE 8000
+#define PCM_BLOCK_SAMPLES 128 // Por metade do buffer duplo (16 ms)
+#define PCM_VOICES 2          // Sons que podem tocar ao mesmo tempo
+
+// Clipe de 8 bits sem sinal (128 = silêncio); pode ficar direto na flash (XIP)
+typedef struct {
+  const uint8_t *samples;
+  uint32_t length;
+} pcm_clip_t;
+
+void pcm_init(uint pin);
+bool pcm_play(const pcm_clip_t *clip);
+void pcm_stop(void);
+bool pcm_playing(void);
+
+#endif
@@ -0,0 +1,42 @@
+#include "perf.h"
+
+#if PERF_ENABLED
+
+#include <stdio.h>
+#include "console.h"
+
+perf_counter_t perf_counters[PERF_COUNT];
+volatile uint32_t perf_epoch;
+
+static const char *const perf_names[PERF_COUNT] = {
+  [PERF_OLED_SEND] = "ssd1306_send",
+  [PERF_OLED_FILL] = "ssd1306_fill",
+  [PERF_OLED_STRING] = "ssd1306_string",
+  [PERF_MATRIX] = "atualizar_matriz",
+  [PERF_BUZZER] = "buzzer_play",
+  [PERF_GPIO_IRQ] = "gpio_irq",
+};
+
+// O relatório é pedido com PERF_REPORT_CHAR no console da USB
+void perf_init(void) {
+  console_add_command(PERF_REPORT_CHAR, perf_report);
+}
+
+// Imprime a tabela e zera os contadores. Roda no núcleo 0, mas parte dos
+// contadores é do núcleo 1 (saídas): aqui só se lê, e um contador de uma
+// época anterior ainda não foi zerado pelo dono, então vale zero.
+void perf_report(void) {
+  uint32_t epoch = perf_epoch;
+  printf("PERF %-16s %10s %10s %8s %8s\n", "funcao", "chamadas", "total us", "media", "max us");
+  for (uint i = 0; i < PERF_COUNT; ++i) {
+    perf_counter_t c = perf_counters[i];
+    if (c.epoch != epoch)
+      c = (perf_counter_t){0};
+    printf("PERF %-16s %10lu %10lu %8lu %8lu\n", perf_names[i], (unsigned long)c.calls,
+           (unsigned long)c.total_us, (unsigned long)(c.calls ? c.total_us / c.calls : 0),
+           (unsigned long)c.max_us);
+  }
+  perf_epoch = epoch + 1;
+}
+
+#endif
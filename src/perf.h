@@ -0,0 +1,62 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include "pico/stdlib.h"
+
+// Contadores das funções mais quentes, medidos com o timer do RP2040 (µs).
+// Com PERF_ENABLED=0 (CMakeLists.txt) as medições somem do código.
+#ifndef PERF_ENABLED
+#define PERF_ENABLED 1
+#endif
+
+#define PERF_REPORT_CHAR 'p' // Pedido do relatório pela USB
+
+typedef enum {
+  PERF_OLED_SEND,   // ssd1306_send_data_async
+  PERF_OLED_FILL,   // ssd1306_fill
+  PERF_OLED_STRING, // ssd1306_draw_string
+  PERF_MATRIX,      // atualizar_matriz (composição + entrega à saída)
+  PERF_BUZZER,      // buzzer_play
+  PERF_GPIO_IRQ,    // IRQ dos botões
+  PERF_COUNT,
+} perf_id_t;
+
+typedef struct {
+  uint32_t calls;
+  uint32_t total_us;
+  uint32_t max_us;
+  uint32_t epoch;   // Valor de perf_epoch quando o contador foi zerado
+} perf_counter_t;
+
+#if PERF_ENABLED
+// Cada contador é atualizado por um único núcleo e contexto (IRQ ou laço), e
+// só ele escreve no contador: o relatório pede o reset avançando perf_epoch,
+// e o dono zera o contador na próxima medição
+extern perf_counter_t perf_counters[PERF_COUNT];
+extern volatile uint32_t perf_epoch;
+
+static inline void perf_record(perf_id_t id, uint32_t start) {
+  uint32_t elapsed = time_us_32() - start;
+  perf_counter_t *c = &perf_counters[id];
+  uint32_t epoch = perf_epoch;
+  if (c->epoch != epoch)
+    *c = (perf_counter_t){ .epoch = epoch };
+  c->calls++;
+  c->total_us += elapsed;
+  if (elapsed > c->max_us)
+    c->max_us = elapsed;
+}
+
+#define PERF_BEGIN() uint32_t perf_start_ = time_us_32()
+#define PERF_END(id) perf_record((id), perf_start_)
+
+void perf_init(void);
+void perf_report(void);
+#else
+#define PERF_BEGIN() ((void)0)
+#define PERF_END(id) ((void)0)
+#define perf_init() ((void)0)
+#define perf_report() ((void)0)
+#endif
+
+#endif
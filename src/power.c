@@ -0,0 +1,101 @@
+#include "power.h"
+#include <stdio.h>
+#include "hardware/clocks.h"
+#include "sched.h"
+#include "output.h"
+#include "console.h"
+
+// Clocks cortados enquanto os dois núcleos dormem com SLEEPDEEP em POWER_OFF
+// (o núcleo 0 em sched_run, o 1 no laço de src/output.c com a tela
+// desligada); ao acordar, o hardware volta sozinho aos clocks de wake_en.
+// Sem OUTPUT_MULTICORE o núcleo 1 fica no bootrom e os cortes não valem.
+// Nenhum desses blocos tem trabalho até o alarme ou um botão. Ficam o timer
+// (e o watchdog, que gera o tick dele), IO/pads para as IRQs dos botões, USB,
+// DMA e I2C (comandos do display ainda saindo), memórias e barramento.
+// O clk_sys não é reduzido: os divisores do I2C, do PIO e do PCM dependem dele.
+#define POWER_GATED_EN0 (CLOCKS_SLEEP_EN0_CLK_SYS_ADC_BITS | CLOCKS_SLEEP_EN0_CLK_ADC_ADC_BITS | \
+                         CLOCKS_SLEEP_EN0_CLK_SYS_I2C0_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_JTAG_BITS | \
+                         CLOCKS_SLEEP_EN0_CLK_SYS_PIO0_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_PIO1_BITS | \
+                         CLOCKS_SLEEP_EN0_CLK_SYS_PWM_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_RTC_BITS | \
+                         CLOCKS_SLEEP_EN0_CLK_RTC_RTC_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_SPI0_BITS | \
+                         CLOCKS_SLEEP_EN0_CLK_PERI_SPI0_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_SPI1_BITS | \
+                         CLOCKS_SLEEP_EN0_CLK_PERI_SPI1_BITS)
+#define POWER_GATED_EN1 (CLOCKS_SLEEP_EN1_CLK_SYS_TBMAN_BITS | CLOCKS_SLEEP_EN1_CLK_SYS_UART0_BITS | \
+                         CLOCKS_SLEEP_EN1_CLK_PERI_UART0_BITS | CLOCKS_SLEEP_EN1_CLK_SYS_UART1_BITS | \
+                         CLOCKS_SLEEP_EN1_CLK_PERI_UART1_BITS)
+
+static const char *const power_names[POWER_STATES] = {
+  [POWER_ACTIVE] = "ativo",
+  [POWER_DIM] = "tela fraca",
+  [POWER_OFF] = "tela apagada",
+};
+
+static power_state_t state;
+static power_stats_t stats;
+static uint64_t state_since_us, idle_since_us;
+
+// Soma ao estado atual o tempo desde a última contagem
+static void power_account(void) {
+  uint64_t now = time_us_64();
+  uint64_t idle = sched_idle_total_us();
+  stats.time_us[state] += now - state_since_us;
+  stats.sleep_us[state] += idle - idle_since_us;
+  state_since_us = now;
+  idle_since_us = idle;
+}
+
+void power_init(void) {
+  state = POWER_ACTIVE;
+  stats = (power_stats_t){0};
+  stats.entries[POWER_ACTIVE] = 1;
+  state_since_us = time_us_64();
+  idle_since_us = sched_idle_total_us();
+  console_add_command(POWER_REPORT_CHAR, power_report);
+}
+
+// Troca de estado: tela (e o sono profundo do núcleo 1) pelo núcleo de
+// saída, clocks do sono e sono profundo do núcleo 0 aqui mesmo
+void power_set(power_state_t next) {
+  if (next == state)
+    return;
+  power_account();
+  stats.entries[next]++;
+
+  if (next == POWER_OFF) {
+    output_display(false, 0);
+    clocks_hw->sleep_en0 = ~POWER_GATED_EN0;
+    clocks_hw->sleep_en1 = ~POWER_GATED_EN1;
+    sched_set_deep_sleep(true);
+  } else {
+    if (state == POWER_OFF) {
+      sched_set_deep_sleep(false);
+      clocks_hw->sleep_en0 = ~0u;
+      clocks_hw->sleep_en1 = ~0u;
+    }
+    output_display(true, next == POWER_DIM ? POWER_DIM_CONTRAST : 0xFF);
+  }
+  state = next;
+}
+
+power_state_t power_get(void) {
+  return state;
+}
+
+void power_get_stats(power_stats_t *out, bool reset) {
+  power_account();
+  *out = stats;
+  if (reset) {
+    stats = (power_stats_t){0};
+    stats.entries[state] = 1;
+  }
+}
+
+// Imprime o tempo em cada estado e zera os contadores
+void power_report(void) {
+  power_stats_t s;
+  power_get_stats(&s, true);
+  printf("ENERGIA %-12s %8s %10s %12s\n", "estado", "entradas", "tempo ms", "dormindo ms");
+  for (uint i = 0; i < POWER_STATES; ++i)
+    printf("ENERGIA %-12s %8lu %10lu %12lu\n", power_names[i], (unsigned long)s.entries[i],
+           (unsigned long)(s.time_us[i] / 1000), (unsigned long)(s.sleep_us[i] / 1000));
+}
@@ -0,0 +1,31 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include "pico/stdlib.h"
+
+// Estados de energia da contagem. O núcleo 0 já dorme em __wfi() até o
+// alarme de hardware ou a IRQ de um botão; aqui se escolhe o que fica ligado
+// enquanto ele dorme.
+#define POWER_REPORT_CHAR 'e'    // Pedido do relatório pela USB
+#define POWER_DIM_CONTRAST 0x08  // Contraste da tela fraca (o normal é 0xFF)
+
+typedef enum {
+  POWER_ACTIVE, // Tudo ligado, tela no contraste normal
+  POWER_DIM,    // Tela com contraste baixo
+  POWER_OFF,    // Tela desligada e clocks dos periféricos parados no sono
+  POWER_STATES,
+} power_state_t;
+
+typedef struct {
+  uint32_t entries[POWER_STATES];
+  uint64_t time_us[POWER_STATES];
+  uint64_t sleep_us[POWER_STATES];  // Parte do tempo com o núcleo 0 em __wfi()
+} power_stats_t;
+
+void power_init(void);
+void power_set(power_state_t state);
+power_state_t power_get(void);
+void power_get_stats(power_stats_t *stats, bool reset);
+void power_report(void);
+
+#endif
@@ -0,0 +1,196 @@
+#include "sched.h"
+#include "hardware/sync.h"
+#include "hardware/structs/scb.h"
+
+// Agendador cooperativo: cada evento é tratado até o fim (run-to-completion)
+// por todos os handlers registrados. Sem eventos pendentes, o núcleo dorme
+// em __wfi() até a próxima interrupção.
+
+static sched_event_t queue[SCHED_QUEUE_LEN];
+static volatile uint8_t queue_head, queue_tail;
+static volatile bool wake_pending;
+
+static sched_handler_t handlers[SCHED_MAX_HANDLERS];
+static uint8_t handler_count;
+static sched_poll_t polls[SCHED_MAX_POLLS];
+static uint8_t poll_count;
+
+static uint32_t input_mask; // Bits dos ids de evento que representam entrada do usuário
+static sched_stats_t stats;
+static uint64_t stats_start;
+static uint64_t idle_total_us;
+static bool deep_sleep;
+
+void sched_init(void) {
+  queue_head = queue_tail = 0;
+  wake_pending = false;
+  handler_count = poll_count = 0;
+  input_mask = 0;
+  stats = (sched_stats_t){0};
+  stats_start = time_us_64();
+}
+
+// Registro só na inicialização: passar do limite é erro de configuração
+// (um módulo ficaria mudo), então para com hard_assert em vez de ignorar
+bool sched_add_handler(sched_handler_t handler) {
+  hard_assert(handler_count < SCHED_MAX_HANDLERS);
+  if (handler_count >= SCHED_MAX_HANDLERS)
+    return false;
+  handlers[handler_count++] = handler;
+  return true;
+}
+
+// Polls rodam a cada volta do laço, antes dos eventos (ex.: drenar filas
+// preenchidas por IRQs). Devem retornar true se fizeram algum trabalho.
+bool sched_add_poll(sched_poll_t poll) {
+  hard_assert(poll_count < SCHED_MAX_POLLS);
+  if (poll_count >= SCHED_MAX_POLLS)
+    return false;
+  polls[poll_count++] = poll;
+  return true;
+}
+
+static bool sched_push(const sched_event_t *ev) {
+  uint32_t status = save_and_disable_interrupts();
+  uint8_t next = (queue_tail + 1) % SCHED_QUEUE_LEN;
+  bool ok = next != queue_head;
+  if (ok) {
+    queue[queue_tail] = *ev;
+    queue_tail = next;
+  } else {
+    stats.dropped++;
+  }
+  restore_interrupts(status);
+  return ok;
+}
+
+static bool sched_pop(sched_event_t *ev) {
+  uint32_t status = save_and_disable_interrupts();
+  bool ok = queue_head != queue_tail;
+  if (ok) {
+    *ev = queue[queue_head];
+    queue_head = (queue_head + 1) % SCHED_QUEUE_LEN;
+  }
+  restore_interrupts(status);
+  return ok;
+}
+
+// Pode ser chamada de IRQs
+bool sched_post_at(uint16_t id, uint32_t arg, uint64_t timestamp) {
+  sched_event_t ev = { .id = id, .arg = arg, .timestamp = timestamp, .timer = NULL };
+  return sched_push(&ev);
+}
+
+bool sched_post(uint16_t id, uint32_t arg) {
+  return sched_post_at(id, arg, time_us_64());
+}
+
+// Pede uma nova volta dos polls (para IRQs que não postam eventos)
+void sched_wake(void) {
+  wake_pending = true;
+}
+
+static int64_t sched_alarm_callback(alarm_id_t id, void *user_data) {
+  sched_timer_t *timer = user_data;
+  sched_event_t ev = { .id = timer->event, .arg = timer->gen, .timestamp = time_us_64(), .timer = timer };
+  sched_push(&ev);
+  if (timer->period_us > 0)
+    return timer->period_us; // Reagenda a partir do disparo anterior (taxa fixa)
+  timer->alarm = 0;
+  return 0;
+}
+
+void sched_timer_start(sched_timer_t *timer, uint16_t event, uint32_t delay_us, bool periodic) {
+  sched_timer_stop(timer);
+  timer->event = event;
+  timer->period_us = periodic ? delay_us : 0;
+  if (delay_us == 0)
+    delay_us = 1;
+  timer->alarm = add_alarm_in_us(delay_us, sched_alarm_callback, timer, true);
+}
+
+void sched_timer_stop(sched_timer_t *timer) {
+  if (timer->alarm > 0)
+    cancel_alarm(timer->alarm);
+  timer->alarm = 0;
+  timer->gen++;
+}
+
+// Marca o id como evento de entrada, para medir a latência de entrada
+void sched_mark_input(uint16_t id) {
+  if (id < 32)
+    input_mask |= 1u << id;
+}
+
+// Com SLEEPDEEP o __wfi() deste núcleo conta como sono profundo: quando os
+// dois núcleos estão assim, valem os clocks de clocks_hw->sleep_en0/1. O
+// hardware volta aos clocks de wake_en sozinho ao acordar.
+void sched_set_deep_sleep(bool deep) {
+  deep_sleep = deep;
+}
+
+// Tempo total dormindo desde o boot (não é zerado com as estatísticas)
+uint64_t sched_idle_total_us(void) {
+  return idle_total_us;
+}
+
+void sched_get_stats(sched_stats_t *out, bool reset) {
+  uint64_t now = time_us_64();
+  *out = stats;
+  out->window_us = now - stats_start;
+  if (reset) {
+    stats.latency_max_us = 0;
+    stats.input_latency_max_us = 0;
+    stats.loops = 0;
+    stats.idle_us = 0;
+    stats_start = now;
+  }
+}
+
+static void sched_dispatch(const sched_event_t *ev) {
+  if (ev->timer && ev->arg != ev->timer->gen)
+    return; // Temporizador reiniciado ou parado depois do disparo
+
+  uint32_t latency = (uint32_t)(time_us_64() - ev->timestamp);
+  if (latency > stats.latency_max_us)
+    stats.latency_max_us = latency;
+  if (ev->id < 32 && (input_mask & (1u << ev->id)) && latency > stats.input_latency_max_us)
+    stats.input_latency_max_us = latency;
+  stats.dispatched++;
+
+  for (uint8_t i = 0; i < handler_count; ++i)
+    handlers[i](ev);
+}
+
+_Noreturn void sched_run(void) {
+  while (true) {
+    wake_pending = false;
+    stats.loops++;
+    bool busy = false;
+    for (uint8_t i = 0; i < poll_count; ++i)
+      busy |= polls[i]();
+
+    sched_event_t ev;
+    if (sched_pop(&ev)) {
+      sched_dispatch(&ev);
+      continue;
+    }
+    if (busy)
+      continue;
+
+    // Só dorme se nenhuma IRQ postou algo depois da verificação acima;
+    // o __wfi() retorna com a interrupção pendente mesmo mascarada.
+    uint32_t status = save_and_disable_interrupts();
+    if (queue_head == queue_tail && !wake_pending) {
+      uint64_t start = time_us_64();
+      if (deep_sleep)
+        scb_hw->scr |= M0PLUS_SCR_SLEEPDEEP_BITS;
+      __wfi();
+      scb_hw->scr &= ~M0PLUS_SCR_SLEEPDEEP_BITS;
+      uint32_t slept = (uint32_t)(time_us_64() - start);
+      stats.idle_us += slept;
+      idle_total_us += slept;
+    }
+    restore_interrupts(status);
+  }
+}
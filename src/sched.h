@@ -0,0 +1,57 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "pico/stdlib.h"
+
+#define SCHED_QUEUE_LEN 32
+#define SCHED_MAX_HANDLERS 6 // Hoje: 3 handlers e até 4 polls, com folga
+#define SCHED_MAX_POLLS 6
+
+struct sched_timer;
+
+typedef struct {
+  uint16_t id;
+  uint32_t arg;
+  uint64_t timestamp;          // Instante em que o evento foi postado
+  struct sched_timer *timer;   // Temporizador de origem (ou NULL)
+} sched_event_t;
+
+// Temporizador de software apoiado no alarme de hardware (alarm pool do SDK).
+// Ao expirar, posta `event` na fila do agendador.
+typedef struct sched_timer {
+  alarm_id_t alarm;
+  uint16_t event;
+  uint32_t gen;        // Descarta disparos de um temporizador já reiniciado/parado
+  int64_t period_us;   // 0 = dispara uma única vez
+} sched_timer_t;
+
+typedef struct {
+  uint32_t dispatched;
+  uint32_t dropped;             // Eventos perdidos com a fila cheia
+  uint32_t latency_max_us;      // Maior atraso entre postar e tratar um evento
+  uint32_t input_latency_max_us;
+  uint32_t loops;               // Voltas do laço principal
+  uint64_t idle_us;             // Tempo dormindo em __wfi()
+  uint64_t window_us;           // Tempo desde o último reset (não volta a zero em 71 min)
+} sched_stats_t;
+
+typedef void (*sched_handler_t)(const sched_event_t *ev);
+typedef bool (*sched_poll_t)(void);
+
+void sched_init(void);
+bool sched_add_handler(sched_handler_t handler);
+bool sched_add_poll(sched_poll_t poll);
+bool sched_post(uint16_t id, uint32_t arg);
+bool sched_post_at(uint16_t id, uint32_t arg, uint64_t timestamp);
+void sched_wake(void);
+_Noreturn void sched_run(void);
+void sched_set_deep_sleep(bool deep);
+
+void sched_timer_start(sched_timer_t *timer, uint16_t event, uint32_t delay_us, bool periodic);
+void sched_timer_stop(sched_timer_t *timer);
+
+void sched_mark_input(uint16_t id);
+void sched_get_stats(sched_stats_t *stats, bool reset);
+uint64_t sched_idle_total_us(void);
+
+#endif
@@ -0,0 +1,54 @@
+#include "screen.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCREEN_IMAGE_SIZE (WIDTH * HEIGHT / 8)
+
+// Tela cujo conteúdo está atualmente em ram_buffer, e a imagem da camada
+// estática dela. Uma imagem só, compartilhada: trocar de tela redesenha a
+// camada estática, e só as atualizações da mesma tela saem do cache.
+static screen_t *screen_active = NULL;
+static uint8_t background[SCREEN_IMAGE_SIZE];
+
+// Desenha a camada estática (borda e rótulos) e guarda a imagem em background
+static void screen_render_static(ssd1306_t *ssd, screen_t *screen) {
+  ssd1306_fill(ssd, false);
+  if (screen->border)
+    ssd1306_rect(ssd, 0, 0, ssd->width, ssd->height, true, false);
+  for (uint8_t i = 0; i < screen->label_count; ++i)
+    ssd1306_draw_string(ssd, screen->labels[i].text, screen->labels[i].x, screen->labels[i].y);
+
+  hard_assert(ssd->bufsize - 1 <= sizeof(background));
+  memcpy(background, &ssd->ram_buffer[1], ssd->bufsize - 1);
+}
+
+// Mostra a tela em ram_buffer (o envio ao display fica com quem chama).
+// Se a tela já está ativa, apenas os campos cujo texto mudou são apagados
+// (restaurando o fundo guardado) e redesenhados.
+void screen_show(ssd1306_t *ssd, screen_t *screen, const int *values) {
+  bool redraw_all = screen != screen_active;
+
+  if (redraw_all) {
+    screen_render_static(ssd, screen);
+    screen_active = screen;
+  }
+
+  for (uint8_t i = 0; i < screen->field_count && i < SCREEN_MAX_FIELDS; ++i) {
+    const screen_field_t *field = &screen->fields[i];
+    char text[SCREEN_FIELD_LEN];
+    snprintf(text, sizeof(text), field->format, values ? values[i] : 0);
+
+    if (!redraw_all) {
+      if (strcmp(text, screen->text[i]) == 0)
+        continue;
+      ssd1306_restore_string(ssd, background, screen->text[i], field->x, field->y);
+    }
+    ssd1306_draw_string(ssd, text, field->x, field->y);
+    memcpy(screen->text[i], text, sizeof(text));
+  }
+}
+
+// Deve ser chamada quando algo for desenhado no display fora de screen_show
+void screen_invalidate(void) {
+  screen_active = NULL;
+}
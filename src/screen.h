@@ -0,0 +1,46 @@
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include "ssd1306.h"
+
+#define SCREEN_MAX_FIELDS 5
+#define SCREEN_FIELD_LEN 20
+
+// Texto fixo da tela
+typedef struct {
+  const char *text;
+  uint8_t x, y;
+} screen_label_t;
+
+// Campo dinâmico: formato printf com um único %d
+typedef struct {
+  const char *format;
+  uint8_t x, y;
+} screen_field_t;
+
+// Tela em modo retido: ao entrar na tela, borda e rótulos são desenhados e
+// guardados como fundo; a cada atualização só os campos que mudaram são redesenhados.
+typedef struct {
+  const screen_label_t *labels;
+  uint8_t label_count;
+  const screen_field_t *fields;
+  uint8_t field_count;
+  bool border;
+  char text[SCREEN_MAX_FIELDS][SCREEN_FIELD_LEN];
+} screen_t;
+
+#define SCREEN_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+#define SCREEN_STATIC(labels) \
+  { (labels), SCREEN_COUNT(labels), NULL, 0, true, {{0}} }
+
+#define SCREEN_FIELDS(fields) \
+  { NULL, 0, (fields), SCREEN_COUNT(fields), true, {{0}} }
+
+#define SCREEN_WITH_FIELDS(labels, fields) \
+  { (labels), SCREEN_COUNT(labels), (fields), SCREEN_COUNT(fields), true, {{0}} }
+
+void screen_show(ssd1306_t *ssd, screen_t *screen, const int *values);
+void screen_invalidate(void);
+
+#endif
@@ -0,0 +1,72 @@
+#include "scroller.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCROLLER_RAM_ROWS (SCROLLER_PAGES * 8)
+
+// Redesenha uma página da GDDRAM com a linha do texto, centralizada e
+// cortada na largura da tela
+static void scroller_draw(scroller_t *scroller, uint8_t page) {
+  ssd1306_t *ssd = scroller->ssd;
+  char text[SCROLLER_LINE_LEN];
+  snprintf(text, sizeof(text), scroller->lines[scroller->page_line[page]], scroller->value);
+  ssd1306_rect(ssd, page * 8, 0, ssd->width, 8, false, true);
+  size_t width = strlen(text) * 8;
+  ssd1306_draw_string_page(ssd, text, width < ssd->width ? (ssd->width - width) / 2 : 0, page);
+}
+
+// Preenche o anel com as primeiras linhas e reduz o painel para 7 páginas.
+// O envio das páginas desenhadas fica com quem chama.
+void scroller_start(scroller_t *scroller, ssd1306_t *ssd, const char *const *lines, uint8_t count, int value) {
+  scroller->ssd = ssd;
+  scroller->lines = lines;
+  scroller->count = count;
+  scroller->value = value;
+  scroller->start = 0;
+  for (uint8_t page = 0; page < SCROLLER_PAGES; ++page) {
+    scroller->page_line[page] = page % count;
+    scroller_draw(scroller, page);
+  }
+  scroller->next = SCROLLER_PAGES % count;
+  scroller->active = true;
+  ssd1306_set_start_line(ssd, 0);
+  // O anel precisa de uma página fora da tela para receber a próxima linha
+  // sem ela aparecer pela metade; a troca é perder as 8 linhas de baixo do
+  // painel durante toda a rolagem (scroller_stop devolve o MUX inteiro)
+  ssd1306_set_mux_ratio(ssd, SCROLLER_ROWS);
+}
+
+// Sobe o texto uma linha de pixels
+void scroller_step(scroller_t *scroller) {
+  if (!scroller->active)
+    return;
+  scroller->start = (scroller->start + 1) % SCROLLER_RAM_ROWS;
+  ssd1306_set_start_line(scroller->ssd, scroller->start);
+  if (scroller->start % 8 == 0) {
+    // A página que acabou de sair pelo topo está escondida: recebe a próxima linha
+    uint8_t page = (scroller->start / 8 + SCROLLER_PAGES - 1) % SCROLLER_PAGES;
+    scroller->page_line[page] = scroller->next;
+    scroller->next = (scroller->next + 1) % scroller->count;
+    scroller_draw(scroller, page);
+  }
+}
+
+// Troca o valor do %d e redesenha só as páginas que o mostram
+void scroller_set_value(scroller_t *scroller, int value) {
+  if (!scroller->active || value == scroller->value)
+    return;
+  scroller->value = value;
+  for (uint8_t page = 0; page < SCROLLER_PAGES; ++page) {
+    if (strchr(scroller->lines[scroller->page_line[page]], '%'))
+      scroller_draw(scroller, page);
+  }
+}
+
+// Volta o painel inteiro e a start line ao normal; a próxima tela redesenha tudo
+void scroller_stop(scroller_t *scroller) {
+  if (!scroller->active)
+    return;
+  scroller->active = false;
+  ssd1306_set_mux_ratio(scroller->ssd, scroller->ssd->height);
+  ssd1306_set_start_line(scroller->ssd, 0);
+}
@@ -0,0 +1,31 @@
+#ifndef SCROLLER_H
+#define SCROLLER_H
+
+#include "ssd1306.h"
+
+// Rolagem vertical de texto pelo registrador de start line. As 8 páginas da
+// GDDRAM formam um anel de linhas de texto; o painel mostra 7 (MUX de 56
+// linhas) e a oitava, escondida, recebe a próxima linha. Cada passo sobe uma
+// linha de pixels com um comando de 1 byte; a cada 8 passos uma página
+// (128 bytes) é gravada, em vez do quadro inteiro.
+#define SCROLLER_PAGES 8
+#define SCROLLER_ROWS 56
+#define SCROLLER_LINE_LEN 20
+
+typedef struct {
+  ssd1306_t *ssd;
+  const char *const *lines;  // Texto em laço; uma linha pode ter um %d (o valor)
+  uint8_t count;
+  uint8_t next;              // Próxima linha do texto a entrar no anel
+  uint8_t start;             // Start line atual (0..63)
+  uint8_t page_line[SCROLLER_PAGES]; // Linha do texto em cada página da GDDRAM
+  int value;
+  bool active;
+} scroller_t;
+
+void scroller_start(scroller_t *scroller, ssd1306_t *ssd, const char *const *lines, uint8_t count, int value);
+void scroller_step(scroller_t *scroller);
+void scroller_set_value(scroller_t *scroller, int value);
+void scroller_stop(scroller_t *scroller);
+
+#endif
@@ -1,5 +1,17 @@
 #include "ssd1306.h"
 #include "font.h"
+#include <string.h>
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "trace.h"
+#include "perf.h"
+
+// Display com envio em andamento em cada bloco I2C (usado pela IRQ)
+static ssd1306_t *flush_owner[2];
+
+static void ssd1306_i2c_irq(void);
+static bool ssd1306_send_window(ssd1306_t *ssd);
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
   ssd->width = width;
@@ -10,38 +22,57 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
   ssd->bufsize = ssd->pages * ssd->width + 1;
   ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
   ssd->ram_buffer[0] = 0x40;
+  ssd->shadow_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  ssd->tx_buffer = calloc(ssd->bufsize + SSD1306_TX_HEADER, sizeof(uint16_t));
   ssd->port_buffer[0] = 0x80;
+  ssd->shadow_valid = false;
+  ssd1306_mark_dirty(ssd, 0, 0, width - 1, height - 1);
+
+  ssd->busy = false;
+  ssd->flush_cb = NULL;
+  ssd->dma_chan = dma_claim_unused_channel(true);
+  dma_channel_config c = dma_channel_get_default_config(ssd->dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, i2c_get_dreq(i2c, true));
+  dma_channel_configure(ssd->dma_chan, &c, &i2c_get_hw(i2c)->data_cmd, ssd->tx_buffer, 0, false);
+
+  uint irq_num = I2C0_IRQ + i2c_get_index(i2c);
+  flush_owner[i2c_get_index(i2c)] = NULL;
+  irq_add_shared_handler(irq_num, ssd1306_i2c_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(irq_num, true);
 }
 
+// Sequência de inicialização, enviada em uma única transação I2C
+static const uint8_t ssd1306_init_seq[] = {
+  SET_DISP | 0x00,
+  SET_MEM_ADDR, 0x01,
+  SET_DISP_START_LINE | 0x00,
+  SET_SEG_REMAP | 0x01,
+  SET_MUX_RATIO, HEIGHT - 1,
+  SET_COM_OUT_DIR | 0x08,
+  SET_DISP_OFFSET, 0x00,
+  SET_COM_PIN_CFG, 0x12,
+  SET_DISP_CLK_DIV, 0x80,
+  SET_PRECHARGE, 0xF1,
+  SET_VCOM_DESEL, 0x30,
+  SET_CONTRAST, 0xFF,
+  SET_ENTIRE_ON,
+  SET_NORM_INV,
+  SET_CHARGE_PUMP, 0x14,
+  SET_DISP | 0x01
+};
+
 void ssd1306_config(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+  ssd1306_command_list(ssd, ssd1306_init_seq, sizeof(ssd1306_init_seq));
+  // Conteúdo da GDDRAM é indefinido após a inicialização
+  ssd->shadow_valid = false;
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  ssd1306_flush_wait(ssd);
   ssd->port_buffer[1] = command;
   i2c_write_blocking(
     ssd->i2c_port,
@@ -52,67 +83,350 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   );
 }
 
+// Contraste (corrente dos segmentos): o brilho da tela, de 0x00 a 0xFF
+void ssd1306_set_contrast(ssd1306_t *ssd, uint8_t contrast) {
+  const uint8_t commands[] = { SET_CONTRAST, contrast };
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Desligado, o display entra em sleep (~10 µA) e mantém a GDDRAM
+void ssd1306_set_power(ssd1306_t *ssd, bool on) {
+  ssd1306_command(ssd, SET_DISP | (on ? 0x01 : 0x00));
+}
+
+// Linha da GDDRAM mostrada no topo (0..63); o endereçamento das páginas não muda
+void ssd1306_set_start_line(ssd1306_t *ssd, uint8_t line) {
+  ssd1306_command(ssd, SET_DISP_START_LINE | (line & 0x3F));
+}
+
+// Linhas acionadas do painel (16..64); as demais ficam apagadas
+void ssd1306_set_mux_ratio(ssd1306_t *ssd, uint8_t rows) {
+  const uint8_t commands[] = { SET_MUX_RATIO, rows - 1 };
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Rolagem horizontal contínua das páginas page0..page1, feita pelo próprio
+// controlador: nenhum byte no I2C por passo. Não grave a GDDRAM enquanto ela
+// estiver ativa; ssd1306_scroll_stop() a encerra.
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_speed_t speed) {
+  const uint8_t commands[] = {
+    SET_SCROLL_OFF,
+    left ? SET_SCROLL_LEFT : SET_SCROLL_RIGHT, 0x00, page0, speed, page1, 0x00, 0xFF,
+    SET_SCROLL_ON
+  };
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Rolagem horizontal de page0..page1 somada a uma vertical de `vertical_step`
+// linhas por passo, só nas `scroll_rows` linhas abaixo das `fixed_rows` do topo
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_speed_t speed,
+                             uint8_t fixed_rows, uint8_t scroll_rows, uint8_t vertical_step) {
+  const uint8_t commands[] = {
+    SET_SCROLL_OFF,
+    SET_VERT_SCROLL_AREA, fixed_rows, scroll_rows,
+    left ? SET_SCROLL_VERT_LEFT : SET_SCROLL_VERT_RIGHT, 0x00, page0, speed, page1, vertical_step,
+    SET_SCROLL_ON
+  };
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Para a rolagem contínua. O controlador deixa a GDDRAM deslocada, então o
+// próximo envio manda o quadro inteiro.
+void ssd1306_scroll_stop(ssd1306_t *ssd) {
+  ssd1306_command(ssd, SET_SCROLL_OFF);
+  ssd->shadow_valid = false;
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+}
+
+// Envia uma sequência de comandos precedida pelo byte de controle 0x00
+// (Co = 0, D/C = 0), ou seja, uma única transação com um só START/STOP.
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t len) {
+  uint8_t buffer[SSD1306_CMD_LIST_MAX + 1];
+  ssd1306_flush_wait(ssd);
+  buffer[0] = 0x00;
+  while (len > 0) {
+    size_t chunk = len > SSD1306_CMD_LIST_MAX ? SSD1306_CMD_LIST_MAX : len;
+    memcpy(&buffer[1], commands, chunk);
+    i2c_write_blocking(
+      ssd->i2c_port,
+      ssd->address,
+      buffer,
+      chunk + 1,
+      false
+    );
+    commands += chunk;
+    len -= chunk;
+  }
+}
+
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  uint8_t p0 = y0 >> 3;
+  uint8_t p1 = y1 >> 3;
+  if (!ssd->dirty) {
+    ssd->dirty = true;
+    ssd->dirty_x0 = x0;
+    ssd->dirty_x1 = x1;
+    ssd->dirty_p0 = p0;
+    ssd->dirty_p1 = p1;
+    return;
+  }
+  if (x0 < ssd->dirty_x0) ssd->dirty_x0 = x0;
+  if (x1 > ssd->dirty_x1) ssd->dirty_x1 = x1;
+  if (p0 < ssd->dirty_p0) ssd->dirty_p0 = p0;
+  if (p1 > ssd->dirty_p1) ssd->dirty_p1 = p1;
+}
+
+// Encerra o envio assíncrono. Chamado com interrupções desabilitadas, tanto
+// pela IRQ do I2C quanto por ssd1306_flush_busy()/ssd1306_flush_wait().
+static void ssd1306_flush_finish(ssd1306_t *ssd, bool ok) {
+  i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+  hw->intr_mask = 0;
+  (void)hw->clr_stop_det;
+  flush_owner[i2c_get_index(ssd->i2c_port)] = NULL;
+  if (!ok) {
+    // O display pode ter recebido só parte do quadro
+    ssd->shadow_valid = false;
+    ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+  }
+  ssd->busy = false;
+  TRACE(TRACE_OLED_DONE, ok);
+  if (ssd->flush_cb)
+    ssd->flush_cb(ssd, ok);
+}
+
+static bool ssd1306_flush_check(ssd1306_t *ssd) {
+  i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+  if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+    dma_channel_abort(ssd->dma_chan);
+    (void)hw->clr_tx_abrt;
+    ssd1306_flush_finish(ssd, false);
+    return true;
+  }
+  if (dma_channel_is_busy(ssd->dma_chan))
+    return false;
+  if (!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS))
+    return false;
+  ssd1306_flush_finish(ssd, true);
+  return true;
+}
+
+static void ssd1306_i2c_irq(void) {
+  for (uint i = 0; i < 2; ++i) {
+    ssd1306_t *ssd = flush_owner[i];
+    if (ssd && ssd->busy) {
+      i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+      if (!ssd1306_flush_check(ssd))
+        (void)hw->clr_stop_det;
+    }
+  }
+}
+
+bool ssd1306_flush_busy(ssd1306_t *ssd) {
+  if (!ssd->busy)
+    return false;
+  uint32_t status = save_and_disable_interrupts();
+  if (ssd->busy)
+    ssd1306_flush_check(ssd);
+  restore_interrupts(status);
+  return ssd->busy;
+}
+
+void ssd1306_flush_wait(ssd1306_t *ssd) {
+  // Verifica o hardware diretamente para funcionar também dentro de IRQs
+  while (ssd1306_flush_busy(ssd))
+    tight_loop_contents();
+}
+
+void ssd1306_set_flush_callback(ssd1306_t *ssd, ssd1306_flush_cb_t cb) {
+  ssd->flush_cb = cb;
+}
+
+// Inicia o envio, por DMA, apenas da janela de colunas/páginas que mudou
+// desde o último envio. A região marcada pelas funções de desenho é refinada
+// comparando com a cópia do display, então redesenhar o mesmo conteúdo não
+// gera tráfego. A janela é copiada para tx_buffer (quadro da frente), então
+// ram_buffer (quadro de trás) pode ser alterado logo em seguida.
+// Retorna false se o envio anterior ainda não terminou.
+bool ssd1306_send_data_async(ssd1306_t *ssd) {
+  PERF_BEGIN();
+  bool ok = ssd1306_send_window(ssd);
+  PERF_END(PERF_OLED_SEND);
+  return ok;
+}
+
+static bool ssd1306_send_window(ssd1306_t *ssd) {
+  if (ssd1306_flush_busy(ssd))
+    return false;
+  if (!ssd->dirty)
+    return true;
+
+  uint8_t x0 = ssd->dirty_x0, x1 = ssd->dirty_x1;
+  uint8_t p0 = ssd->dirty_p0, p1 = ssd->dirty_p1;
+  ssd->dirty = false;
+
+  if (ssd->shadow_valid) {
+    uint8_t cx0 = 0xFF, cx1 = 0, cp0 = 0xFF, cp1 = 0;
+    for (uint16_t x = x0; x <= x1; ++x) {
+      const uint8_t *ram = &ssd->ram_buffer[x * ssd->pages + 1];
+      const uint8_t *shadow = &ssd->shadow_buffer[x * ssd->pages + 1];
+      for (uint8_t p = p0; p <= p1; ++p) {
+        if (ram[p] != shadow[p]) {
+          if (x < cx0) cx0 = x;
+          cx1 = x;
+          if (p < cp0) cp0 = p;
+          if (p > cp1) cp1 = p;
+        }
+      }
+    }
+    if (cx0 == 0xFF)
+      return true;
+    x0 = cx0; x1 = cx1; p0 = cp0; p1 = cp1;
+  }
+
+  // Janela de endereçamento como uma lista de comandos (uma transação)
+  uint16_t *tx = ssd->tx_buffer;
+  size_t len = 0;
+  tx[len++] = 0x00;
+  tx[len++] = SET_COL_ADDR;
+  tx[len++] = x0;
+  tx[len++] = x1;
+  tx[len++] = SET_PAGE_ADDR;
+  tx[len++] = p0;
+  tx[len++] = p1 | I2C_IC_DATA_CMD_STOP_BITS;
+
+  // Modo de endereçamento vertical: a janela é percorrida coluna a coluna
+  tx[len++] = 0x40;
+  uint8_t npages = p1 - p0 + 1;
+  for (uint16_t x = x0; x <= x1; ++x) {
+    size_t offset = x * ssd->pages + p0 + 1;
+    for (uint8_t p = 0; p < npages; ++p)
+      tx[len++] = ssd->ram_buffer[offset + p];
+    memcpy(&ssd->shadow_buffer[offset], &ssd->ram_buffer[offset], npages);
+  }
+  tx[len - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+  if (!ssd->shadow_valid && x0 == 0 && x1 == ssd->width - 1 && p0 == 0 && p1 == ssd->pages - 1)
+    ssd->shadow_valid = true;
+
+  i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+  hw->enable = 0;
+  hw->tar = ssd->address;
+  hw->enable = 1;
+  (void)hw->clr_stop_det;
+
+  ssd->busy = true;
+  flush_owner[i2c_get_index(ssd->i2c_port)] = ssd;
+  hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+  TRACE(TRACE_OLED_START, len);
+  dma_channel_transfer_from_buffer_now(ssd->dma_chan, tx, len);
+  return true;
+}
+
 void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
-  );
+  ssd1306_flush_wait(ssd);
+  ssd1306_send_data_async(ssd);
+  ssd1306_flush_wait(ssd);
+}
+
+// Reenvia o quadro inteiro, ignorando a cópia do display (recuperação)
+void ssd1306_send_data_full(ssd1306_t *ssd) {
+  ssd1306_flush_wait(ssd);
+  ssd->shadow_valid = false;
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+  ssd1306_send_data(ssd);
 }
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
+  if (x >= ssd->width || y >= ssd->height)
+    return;
   uint16_t index = (y >> 3) + (x << 3) + 1;
   uint8_t pixel = (y & 0b111);
   if (value)
     ssd->ram_buffer[index] |= (1 << pixel);
   else
     ssd->ram_buffer[index] &= ~(1 << pixel);
+  ssd1306_mark_dirty(ssd, x, y, x, y);
 }
 
-/*
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
+// Máscara dos bits de uma página cobertos pelas linhas y0..y1 (0..7)
+static inline uint8_t ssd1306_page_mask(uint8_t y0, uint8_t y1) {
+  return (uint8_t)((0xFF << y0) & (0xFF >> (7 - y1)));
+}
 
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
+// Preenche o retângulo x0..x1, y0..y1 (inclusivo, já recortado) direto no
+// buffer. O buffer é organizado por coluna (endereçamento vertical): cada
+// coluna ocupa `pages` bytes consecutivos, um por página de 8 linhas.
+static void ssd1306_span(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, bool value) {
+  uint8_t p0 = y0 >> 3, p1 = y1 >> 3;
+  uint8_t first = ssd1306_page_mask(y0 & 7, p0 == p1 ? (y1 & 7) : 7);
+  uint8_t last = ssd1306_page_mask(0, y1 & 7);
+  uint8_t *col = &ssd->ram_buffer[x0 * ssd->pages + 1];
+
+  for (uint16_t x = x0; x <= x1; ++x, col += ssd->pages) {
+    if (value) {
+      col[p0] |= first;
+      if (p1 > p0) {
+        for (uint8_t p = p0 + 1; p < p1; ++p)
+          col[p] = 0xFF;
+        col[p1] |= last;
+      }
+    } else {
+      col[p0] &= ~first;
+      if (p1 > p0) {
+        for (uint8_t p = p0 + 1; p < p1; ++p)
+          col[p] = 0x00;
+        col[p1] &= ~last;
+      }
     }
+  }
+  ssd1306_mark_dirty(ssd, x0, y0, x1, y1);
+}
+
+// Recorta x0..x1, y0..y1 (em int, sem estouro de uint8_t) e preenche
+static void ssd1306_span_clip(ssd1306_t *ssd, int x0, int x1, int y0, int y1, bool value) {
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= ssd->width) x1 = ssd->width - 1;
+  if (y1 >= ssd->height) y1 = ssd->height - 1;
+  if (x0 > x1 || y0 > y1)
+    return;
+  ssd1306_span(ssd, x0, x1, y0, y1, value);
+}
+
+void ssd1306_fill(ssd1306_t *ssd, bool value) {
+  PERF_BEGIN();
+  memset(&ssd->ram_buffer[1], value ? 0xFF : 0x00, ssd->bufsize - 1);
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+  PERF_END(PERF_OLED_FILL);
 }
 
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
-  for (uint8_t x = left; x < left + width; ++x) {
-    ssd1306_pixel(ssd, x, top, value);
-    ssd1306_pixel(ssd, x, top + height - 1, value);
-  }
-  for (uint8_t y = top; y < top + height; ++y) {
-    ssd1306_pixel(ssd, left, y, value);
-    ssd1306_pixel(ssd, left + width - 1, y, value);
-  }
+  if (width == 0 || height == 0)
+    return;
+  int right = left + width - 1;
+  int bottom = top + height - 1;
 
   if (fill) {
-    for (uint8_t x = left + 1; x < left + width - 1; ++x) {
-      for (uint8_t y = top + 1; y < top + height - 1; ++y) {
-        ssd1306_pixel(ssd, x, y, value);
-      }
-    }
+    ssd1306_span_clip(ssd, left, right, top, bottom, value);
+    return;
   }
+  ssd1306_span_clip(ssd, left, right, top, top, value);
+  ssd1306_span_clip(ssd, left, right, bottom, bottom, value);
+  ssd1306_span_clip(ssd, left, left, top, bottom, value);
+  ssd1306_span_clip(ssd, right, right, top, bottom, value);
 }
 
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
+    // Linhas horizontais e verticais viram spans
+    if (y0 == y1) {
+        ssd1306_hline(ssd, x0 < x1 ? x0 : x1, x0 < x1 ? x1 : x0, y0, value);
+        return;
+    }
+    if (x0 == x1) {
+        ssd1306_vline(ssd, x0, y0 < y1 ? y0 : y1, y0 < y1 ? y1 : y0, value);
+        return;
+    }
+
     int dx = abs(x1 - x0);
     int dy = abs(y1 - y0);
 
@@ -141,41 +455,55 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 }
 
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
-  for (uint8_t x = x0; x <= x1; ++x)
-    ssd1306_pixel(ssd, x, y, value);
+  ssd1306_span_clip(ssd, x0, x1, y, y, value);
 }
 
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
-  for (uint8_t y = y0; y <= y1; ++y)
-    ssd1306_pixel(ssd, x, y, value);
+  ssd1306_span_clip(ssd, x, x, y0, y1, value);
 }
 
-// Função para desenhar um caractere
+// Função para desenhar um caractere. A fonte já é armazenada por coluna
+// (bit 0 = linha de cima), o mesmo formato das páginas do display: com y
+// múltiplo de 8 cada coluna do glifo é copiada direto para o buffer; caso
+// contrário ela é deslocada e mesclada nas duas páginas que atravessa.
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
 {
-  uint16_t index = 0;
-  char ver=c;
+  uint8_t ch = (uint8_t)c;
+  uint8_t glyph = 0; // Caracteres fora da tabela usam o glifo vazio
 
-  if (c >= 'A' && c <= 'Z')
-    index = (c - 'A' + 11) * 8; // Para letras maiúsculas
-  else  if (c >= '0' && c <= '9')
-    index = (c - '0' + 1) * 8; // Adiciona o deslocamento necessário
-  else if (c >= 'a' && c <= 'z')
-    index = (c - 'a' + 37) * 8; // Para letras minúsculas
+  if (ch >= FONT_FIRST_CHAR && ch <= FONT_LAST_CHAR)
+    glyph = font_index[ch - FONT_FIRST_CHAR];
 
-  for (uint8_t i = 0; i < 8; ++i)
-  {
-    uint8_t line = font[index + i];
-    for (uint8_t j = 0; j < 8; ++j)
-    {
-      ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
+  if (x >= ssd->width || y >= ssd->height)
+    return;
+
+  const uint8_t *bitmap = &font[glyph * 8];
+  uint8_t cols = ssd->width - x < 8 ? ssd->width - x : 8;
+  uint8_t page = y >> 3;
+  uint8_t shift = y & 7;
+  uint8_t *col = &ssd->ram_buffer[x * ssd->pages + page + 1];
+
+  if (shift == 0) {
+    for (uint8_t i = 0; i < cols; ++i, col += ssd->pages)
+      *col = bitmap[i];
+  } else {
+    uint8_t low = (1 << shift) - 1; // Linhas acima de y na primeira página
+    bool next = page + 1 < ssd->pages;
+    for (uint8_t i = 0; i < cols; ++i, col += ssd->pages) {
+      col[0] = (col[0] & low) | (uint8_t)(bitmap[i] << shift);
+      if (next)
+        col[1] = (col[1] & ~low) | (bitmap[i] >> (8 - shift));
     }
   }
+
+  uint8_t y1 = ssd->height - y < 8 ? ssd->height - 1 : y + 7;
+  ssd1306_mark_dirty(ssd, x, y, x + cols - 1, y1);
 }
 
 // Função para desenhar uma string
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
 {
+  PERF_BEGIN();
   while (*str)
   {
     ssd1306_draw_char(ssd, *str++, x, y);
@@ -190,4 +518,64 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
       break;
     }
   }
-}
\ No newline at end of file
+  PERF_END(PERF_OLED_STRING);
+}
+
+// Escreve o texto em uma única página (inclusive a última), sem quebrar
+// linha: o que passar da largura é cortado
+void ssd1306_draw_string_page(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t page)
+{
+  if (page >= ssd->pages)
+    return;
+  while (*str && x + 8 <= ssd->width)
+  {
+    ssd1306_draw_char(ssd, *str++, x, page * 8);
+    x += 8;
+  }
+}
+
+// Copia uma imagem completa (mesmo formato de ram_buffer, sem o byte de
+// controle) para o buffer do display
+void ssd1306_load_image(ssd1306_t *ssd, const uint8_t *image)
+{
+  memcpy(&ssd->ram_buffer[1], image, ssd->bufsize - 1);
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+}
+
+// Restaura, a partir de uma imagem de fundo, as células 8x8 que a string
+// ocupou. Percorre as posições exatamente como ssd1306_draw_string.
+void ssd1306_restore_string(ssd1306_t *ssd, const uint8_t *image, const char *str, uint8_t x, uint8_t y)
+{
+  while (*str++)
+  {
+    if (x < ssd->width && y < ssd->height)
+    {
+      uint8_t cols = ssd->width - x < 8 ? ssd->width - x : 8;
+      uint8_t page = y >> 3;
+      uint8_t shift = y & 7;
+      uint8_t first = 0xFF << shift;
+      uint8_t second = (1 << shift) - 1;
+      bool next = shift && page + 1 < ssd->pages;
+      size_t offset = x * ssd->pages + page;
+      for (uint8_t i = 0; i < cols; ++i, offset += ssd->pages)
+      {
+        uint8_t *dst = &ssd->ram_buffer[offset + 1];
+        dst[0] = (dst[0] & ~first) | (image[offset] & first);
+        if (next)
+          dst[1] = (dst[1] & ~second) | (image[offset + 1] & second);
+      }
+      uint8_t y1 = ssd->height - y < 8 ? ssd->height - 1 : y + 7;
+      ssd1306_mark_dirty(ssd, x, y, x + cols - 1, y1);
+    }
+    x += 8;
+    if (x + 8 >= ssd->width)
+    {
+      x = 0;
+      y += 8;
+    }
+    if (y + 8 >= ssd->height)
+    {
+      break;
+    }
+  }
+}
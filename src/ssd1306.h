@@ -25,22 +25,72 @@ typedef enum {
   SET_DISP_CLK_DIV = 0xD5,
   SET_PRECHARGE = 0xD9,
   SET_VCOM_DESEL = 0xDB,
-  SET_CHARGE_PUMP = 0x8D
+  SET_CHARGE_PUMP = 0x8D,
+  SET_SCROLL_RIGHT = 0x26,
+  SET_SCROLL_LEFT = 0x27,
+  SET_SCROLL_VERT_RIGHT = 0x29,
+  SET_SCROLL_VERT_LEFT = 0x2A,
+  SET_SCROLL_OFF = 0x2E,
+  SET_SCROLL_ON = 0x2F,
+  SET_VERT_SCROLL_AREA = 0xA3
 } ssd1306_command_t;
 
-typedef struct {
+// Intervalo entre passos da rolagem contínua, em quadros do display
+typedef enum {
+  SSD1306_SCROLL_2_FRAMES = 7,
+  SSD1306_SCROLL_3_FRAMES = 4,
+  SSD1306_SCROLL_4_FRAMES = 5,
+  SSD1306_SCROLL_5_FRAMES = 0,
+  SSD1306_SCROLL_25_FRAMES = 6,
+  SSD1306_SCROLL_64_FRAMES = 1,
+  SSD1306_SCROLL_128_FRAMES = 2,
+  SSD1306_SCROLL_256_FRAMES = 3
+} ssd1306_scroll_speed_t;
+
+// Maior lista de comandos enviada por transação em ssd1306_command_list
+#define SSD1306_CMD_LIST_MAX 32
+
+// Palavras de comando que precedem os dados no buffer de envio
+#define SSD1306_TX_HEADER 16
+
+struct ssd1306;
+typedef void (*ssd1306_flush_cb_t)(struct ssd1306 *ssd, bool ok);
+
+typedef struct ssd1306 {
   uint8_t width, height, pages, address;
   i2c_inst_t *i2c_port;
   bool external_vcc;
   uint8_t *ram_buffer;
+  uint8_t *shadow_buffer; // Cópia do que já está na GDDRAM do display
+  uint16_t *tx_buffer; // Quadro em envio: bytes no formato do IC_DATA_CMD
   size_t bufsize;
   uint8_t port_buffer[2];
+  bool dirty, shadow_valid;
+  uint8_t dirty_x0, dirty_x1, dirty_p0, dirty_p1; // Região alterada (colunas/páginas)
+  int dma_chan;
+  volatile bool busy;
+  ssd1306_flush_cb_t flush_cb;
 } ssd1306_t;
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t len);
+void ssd1306_set_contrast(ssd1306_t *ssd, uint8_t contrast);
+void ssd1306_set_power(ssd1306_t *ssd, bool on);
+void ssd1306_set_start_line(ssd1306_t *ssd, uint8_t line);
+void ssd1306_set_mux_ratio(ssd1306_t *ssd, uint8_t rows);
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_speed_t speed);
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_speed_t speed,
+                             uint8_t fixed_rows, uint8_t scroll_rows, uint8_t vertical_step);
+void ssd1306_scroll_stop(ssd1306_t *ssd);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_send_data_full(ssd1306_t *ssd);
+bool ssd1306_send_data_async(ssd1306_t *ssd);
+bool ssd1306_flush_busy(ssd1306_t *ssd);
+void ssd1306_flush_wait(ssd1306_t *ssd);
+void ssd1306_set_flush_callback(ssd1306_t *ssd, ssd1306_flush_cb_t cb);
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
@@ -50,5 +100,8 @@ void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+void ssd1306_draw_string_page(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t page);
+void ssd1306_load_image(ssd1306_t *ssd, const uint8_t *image);
+void ssd1306_restore_string(ssd1306_t *ssd, const uint8_t *image, const char *str, uint8_t x, uint8_t y);
 
 #endif
\ No newline at end of file
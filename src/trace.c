@@ -0,0 +1,67 @@
+#include "trace.h"
+
+#if TRACE_ENABLED
+
+#include <stdio.h>
+#include "hardware/sync.h"
+#include "console.h"
+
+// Um anel por núcleo, então os núcleos nunca disputam a mesma posição. No
+// próprio núcleo, IRQs e o laço principal só disputam o contador, que é
+// reservado com as interrupções mascaradas por duas instruções; o evento é
+// escrito depois, já fora da região crítica. O anel sobrescreve os eventos
+// mais antigos: guarda sempre os últimos TRACE_RING_LEN.
+
+typedef struct {
+  trace_event_t events[TRACE_RING_LEN];
+  volatile uint32_t head; // Total de eventos já reservados
+} trace_ring_t;
+
+static trace_ring_t rings[2];
+static volatile bool paused; // Durante o despejo, novos eventos são descartados
+static uint32_t dropped;
+
+void trace_record(uint16_t id, uint32_t arg) {
+  if (paused) {
+    dropped++;
+    return;
+  }
+  uint core = get_core_num();
+  trace_ring_t *ring = &rings[core];
+
+  uint32_t status = save_and_disable_interrupts();
+  uint32_t slot = ring->head++;
+  restore_interrupts(status);
+
+  trace_event_t *ev = &ring->events[slot & (TRACE_RING_LEN - 1)];
+  ev->timestamp = time_us_64();
+  ev->arg = arg;
+  ev->id = id;
+  ev->core = core;
+}
+
+// Despeja os dois anéis como texto (uma linha por evento) e os esvazia
+void trace_dump(void) {
+  paused = true;
+  printf("TRACE BEGIN\n");
+  for (uint core = 0; core < 2; ++core) {
+    trace_ring_t *ring = &rings[core];
+    uint32_t head = ring->head;
+    uint32_t first = head > TRACE_RING_LEN ? head - TRACE_RING_LEN : 0;
+    for (uint32_t i = first; i < head; ++i) {
+      const trace_event_t *ev = &ring->events[i & (TRACE_RING_LEN - 1)];
+      printf("T %u %llu %u %lx\n", ev->core, (unsigned long long)ev->timestamp, ev->id, (unsigned long)ev->arg);
+    }
+    ring->head = 0;
+  }
+  printf("TRACE END %lu\n", (unsigned long)dropped);
+  dropped = 0;
+  paused = false;
+}
+
+// O despejo é pedido com TRACE_DUMP_CHAR no console da USB
+void trace_init(void) {
+  console_add_command(TRACE_DUMP_CHAR, trace_dump);
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "pico/stdlib.h"
+
+// Rastreamento de latência entrada -> LEDs/display. Ligado com
+// TRACE_ENABLED=1 (CMakeLists.txt); desligado, TRACE() some do código e os
+// argumentos nem são avaliados.
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+#define TRACE_RING_LEN 256 // Eventos por núcleo; potência de 2
+#define TRACE_DUMP_CHAR 't' // Pedido de despejo pela USB
+
+// Ids dos pontos de rastreamento (tools/trace_latency.py usa os mesmos números)
+enum {
+  TRACE_BUTTON_EDGE = 1, // IRQ do botão: arg = gpio << 1 | pressionado
+  TRACE_INPUT_EVENT,     // Press/release postado: arg = evento << 8 | ação
+  TRACE_JOYSTICK,        // Direção do joystick mudou: arg = x << 16 | y (16 bits cada)
+  TRACE_MATRIX_BEGIN,    // Aplicação começa a compor o quadro da matriz
+  TRACE_MATRIX_END,      // Quadro composto e entregue à saída
+  TRACE_OUTPUT_CMD,      // Núcleo de saída executa um comando: arg = output_cmd_t
+  TRACE_LED_START,       // DMA da matriz iniciado: arg = quadros enviados
+  TRACE_LED_LATCH,       // Fim do reset, cores visíveis: arg = quadros enviados
+  TRACE_OLED_START,      // DMA do display iniciado: arg = bytes
+  TRACE_OLED_DONE,       // Envio do display terminou: arg = 1 se ok
+};
+
+typedef struct {
+  uint64_t timestamp; // time_us_64()
+  uint32_t arg;
+  uint16_t id;
+  uint16_t core;
+} trace_event_t;
+
+#if TRACE_ENABLED
+void trace_init(void);
+void trace_record(uint16_t id, uint32_t arg);
+void trace_dump(void);
+#define TRACE(id, arg) trace_record((id), (arg))
+#else
+#define trace_init() ((void)0)
+#define trace_dump() ((void)0)
+#define TRACE(id, arg) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,143 @@
+#include "ws2812.h"
+#include <string.h>
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+#include "trace.h"
+#include "projeto_final.pio.h"
+
+// Driver da matriz de LEDs WS2812 (programa matriz_led no PIO). O quadro é
+// copiado para um buffer próprio e enviado ao FIFO do PIO por DMA; a CPU só
+// volta a participar no fim do tempo de reset.
+
+static PIO pio_leds;  // Controlador PIO usado para a matriz de LEDs
+static uint sm_leds;  // Máquina de estado PIO usada para controlar a matriz
+static int dma_leds;
+static uint32_t frame[WS2812_MAX_LEDS]; // Também é a cópia do último quadro enviado
+static uint frame_count;
+static volatile bool busy;
+static ws2812_stats_t stats;      // Só o núcleo que envia os quadros escreve
+static ws2812_stats_t stats_base; // Contadores no último reset, do lado de quem lê
+static alarm_pool_t *pool;
+static ws2812_done_cb_t done_cb;
+static volatile uint32_t *latch_stamp; // Recebe o instante em que o quadro em envio travar
+static volatile uint32_t last_latch_us;
+
+void ws2812_init(uint pin) {
+  pio_leds = pio0; // Usa o controlador PIO0
+
+  int sm = pio_claim_unused_sm(pio_leds, false); // Obtém uma máquina de estado livre
+  if (sm < 0) {
+    pio_leds = pio1; // Se não houver máquinas livres no PIO0, tenta no PIO1
+    sm = pio_claim_unused_sm(pio_leds, true);
+  }
+  sm_leds = sm;
+
+  // O programa é carregado no mesmo PIO da máquina escolhida
+  uint offset = pio_add_program(pio_leds, &matriz_led_program);
+
+  // Inicializa o programa PIO na máquina de estado
+  matriz_led_program_init(pio_leds, sm_leds, offset, pin, 800000.f);
+
+  // Uma palavra de 32 bits por LED, no ritmo do FIFO do PIO
+  dma_leds = dma_claim_unused_channel(true);
+  dma_channel_config c = dma_channel_get_default_config(dma_leds);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, pio_get_dreq(pio_leds, sm_leds, true));
+  dma_channel_configure(dma_leds, &c, &pio_leds->txf[sm_leds], frame, 0, false);
+
+  // Pool próprio para o alarme do fim do quadro: a IRQ dele roda no núcleo
+  // que chama esta função, o mesmo que envia os quadros (o núcleo 1 com
+  // OUTPUT_MULTICORE), então busy e latch_stamp não são disputados entre núcleos
+  pool = alarm_pool_create_with_unused_hardware_alarm(1);
+}
+
+// Fim do quadro + reset. Roda na IRQ do alarm pool da matriz.
+static int64_t ws2812_latch_done(alarm_id_t id, void *user_data) {
+  if (dma_channel_is_busy(dma_leds))
+    return -50; // Ainda transmitindo: confere de novo em 50 µs
+  last_latch_us = time_us_32();
+  TRACE(TRACE_LED_LATCH, stats.sent);
+  if (latch_stamp) {
+    *latch_stamp = last_latch_us;
+    latch_stamp = NULL;
+  }
+  busy = false;
+  if (done_cb)
+    done_cb();
+  return 0;
+}
+
+// Inicia o envio de `count` cores (ws2812_rgb) e retorna na hora. Um quadro
+// igual ao último enviado não é transmitido. Retorna false, sem fazer nada,
+// se o quadro anterior ainda não terminou.
+bool ws2812_show(const uint32_t *grb, uint count) {
+  return ws2812_show_stamped(grb, count, NULL);
+}
+
+// Como ws2812_show(); se `latched_us` não for NULL, recebe time_us_32() do
+// instante em que essas cores ficam visíveis (fim do reset). Para um quadro
+// igual ao último, é o instante em que ele travou (ou vai travar).
+bool ws2812_show_stamped(const uint32_t *grb, uint count, volatile uint32_t *latched_us) {
+  if (count > WS2812_MAX_LEDS)
+    count = WS2812_MAX_LEDS;
+
+  // O DMA só lê `frame`, então a comparação vale mesmo durante um envio
+  if (count == frame_count && memcmp(frame, grb, count * sizeof(uint32_t)) == 0) {
+    stats.suppressed++;
+    if (latched_us) {
+      // Sem IRQs: o fim do quadro entre o teste de busy e a troca do pedido
+      // deixaria o instante sem ninguém para gravá-lo
+      uint32_t status = save_and_disable_interrupts();
+      if (busy)
+        latch_stamp = latched_us;
+      else
+        *latched_us = last_latch_us;
+      restore_interrupts(status);
+    }
+    return true;
+  }
+  if (busy)
+    return false;
+
+  memcpy(frame, grb, count * sizeof(uint32_t));
+  frame_count = count;
+  stats.sent++;
+  latch_stamp = latched_us;
+  busy = true;
+  TRACE(TRACE_LED_START, stats.sent);
+  dma_channel_transfer_from_buffer_now(dma_leds, frame, count);
+
+  // 24 bits a 800 kHz = 30 µs por LED; depois a linha fica em nível baixo
+  // pelo tempo de reset antes de aceitar o próximo quadro
+  uint32_t frame_us = count * 30 + WS2812_RESET_US;
+  if (alarm_pool_add_alarm_in_us(pool, frame_us, ws2812_latch_done, NULL, true) < 0) {
+    busy_wait_us(frame_us); // Sem alarmes livres: espera aqui mesmo
+    last_latch_us = time_us_32();
+    if (latched_us)
+      *latched_us = last_latch_us;
+    latch_stamp = NULL;
+    busy = false;
+  }
+  return true;
+}
+
+bool ws2812_busy(void) {
+  return busy;
+}
+
+// Pode ser chamada do outro núcleo: o reset só move a base, sem escrever
+// nos contadores
+void ws2812_get_stats(ws2812_stats_t *out, bool reset) {
+  ws2812_stats_t now = stats;
+  out->sent = now.sent - stats_base.sent;
+  out->suppressed = now.suppressed - stats_base.suppressed;
+  if (reset)
+    stats_base = now;
+}
+
+// Chamada ao fim de cada quadro (em contexto de IRQ)
+void ws2812_set_done_callback(ws2812_done_cb_t cb) {
+  done_cb = cb;
+}
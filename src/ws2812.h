@@ -0,0 +1,29 @@
+#ifndef WS2812_H
+#define WS2812_H
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+
+#define WS2812_MAX_LEDS 25
+#define WS2812_RESET_US 300  // Linha em nível baixo após o quadro (trava as cores)
+
+// Cor empacotada como o PIO envia: G, R, B a partir do bit 31 (MSB primeiro)
+static inline uint32_t ws2812_rgb(uint8_t r, uint8_t g, uint8_t b) {
+  return ((uint32_t)g << 24) | ((uint32_t)r << 16) | ((uint32_t)b << 8);
+}
+
+typedef void (*ws2812_done_cb_t)(void);
+
+typedef struct {
+  uint32_t sent;        // Quadros transmitidos
+  uint32_t suppressed;  // Quadros iguais ao último enviado (não transmitidos)
+} ws2812_stats_t;
+
+void ws2812_init(uint pin);
+bool ws2812_show(const uint32_t *grb, uint count);
+bool ws2812_show_stamped(const uint32_t *grb, uint count, volatile uint32_t *latched_us);
+bool ws2812_busy(void);
+void ws2812_set_done_callback(ws2812_done_cb_t cb);
+void ws2812_get_stats(ws2812_stats_t *stats, bool reset);
+
+#endif
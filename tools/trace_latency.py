@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Reconstrói a latência entrada -> LEDs/display a partir do rastreamento.
+
+Lê o despejo de src/trace.c (linhas "T <núcleo> <us> <id> <arg hex>") de um
+arquivo, da entrada padrão ou direto da porta serial (--port, precisa do
+pyserial; envia 't' e lê até "TRACE END"). Para cada mudança de entrada
+(borda de botão ou direção do joystick) mostra onde o tempo foi gasto até o
+quadro da matriz travar nos LEDs e até o display terminar de receber a tela.
+
+Firmware compilado com TRACE_ENABLED=1 (CMakeLists.txt).
+"""
+import argparse
+import sys
+
+# Mesmos números de src/trace.h
+BUTTON_EDGE, INPUT_EVENT, JOYSTICK, MATRIX_BEGIN, MATRIX_END, OUTPUT_CMD, \
+    LED_START, LED_LATCH, OLED_START, OLED_DONE = range(1, 11)
+# output_cmd_t (src/output.h)
+OUTPUT_SCREEN, OUTPUT_MATRIX = 0, 1
+
+
+class Event:
+    def __init__(self, core, ts, ev_id, arg):
+        self.core, self.ts, self.id, self.arg = core, ts, ev_id, arg
+
+
+def read_lines(args):
+    if args.port:
+        import serial
+        with serial.Serial(args.port, 115200, timeout=2) as port:
+            port.write(b't')
+            while True:
+                line = port.readline().decode(errors='replace')
+                if not line:
+                    break
+                yield line
+                if line.startswith('TRACE END'):
+                    break
+    else:
+        source = open(args.file) if args.file else sys.stdin
+        yield from source
+
+
+def parse(lines):
+    events = []
+    for line in lines:
+        parts = line.split()
+        if len(parts) == 5 and parts[0] == 'T':
+            events.append(Event(int(parts[1]), int(parts[2]), int(parts[3]), int(parts[4], 16)))
+    # Ordem estável: eventos do mesmo instante ficam na ordem do anel
+    return sorted(events, key=lambda e: e.ts)
+
+
+def find(events, start, ts, ev_id, arg=None):
+    """Primeiro evento `ev_id` em ou depois de `ts`, a partir do índice `start`."""
+    for i in range(start, len(events)):
+        e = events[i]
+        if e.ts >= ts and e.id == ev_id and (arg is None or e.arg == arg):
+            return i, e
+    return None, None
+
+
+def describe(e):
+    if e.id == BUTTON_EDGE:
+        return 'gpio%d %s' % (e.arg >> 1, 'press' if e.arg & 1 else 'solta')
+    x, y = e.arg >> 16, e.arg & 0xFFFF
+    x, y = (x - 0x10000 if x & 0x8000 else x), (y - 0x10000 if y & 0x8000 else y)
+    return 'joy %+d,%+d' % (x, y)
+
+
+def led_chain(events, i, cause, window):
+    """Instantes: aplicação compõe, entrega, núcleo de saída executa, DMA, trava."""
+    j, begin = find(events, i, cause.ts, MATRIX_BEGIN)
+    if not begin or begin.ts - cause.ts > window:
+        return None
+    _, end = find(events, j, begin.ts, MATRIX_END)
+    # Sem multicore o comando roda dentro de atualizar_matriz(), antes do fim
+    j, cmd = find(events, j, begin.ts, OUTPUT_CMD, OUTPUT_MATRIX)
+    j, start = find(events, j, cmd.ts, LED_START) if cmd else (None, None)
+    j, latch = find(events, j, start.ts, LED_LATCH, start.arg) if start else (None, None)
+    if not end or not latch:
+        return None
+    return [begin.ts - cause.ts, end.ts - begin.ts, max(0, cmd.ts - end.ts),
+            start.ts - cmd.ts, latch.ts - start.ts, latch.ts - cause.ts]
+
+
+def oled_chain(events, i, cause, window):
+    j, cmd = find(events, i, cause.ts, OUTPUT_CMD, OUTPUT_SCREEN)
+    if not cmd or cmd.ts - cause.ts > window:
+        return None
+    j, start = find(events, j, cmd.ts, OLED_START)
+    j, done = find(events, j, start.ts, OLED_DONE) if start else (None, None)
+    if not done:
+        return None
+    return [cmd.ts - cause.ts, start.ts - cmd.ts, done.ts - start.ts, done.ts - cause.ts]
+
+
+def fmt(values):
+    return ' '.join('%8d' % v for v in values) if values else ' ' * 8 + '-'
+
+
+def summary(name, rows, columns):
+    if not rows:
+        return
+    print('\n%s (%d amostras, us)' % (name, len(rows)))
+    for k, col in enumerate(columns):
+        values = sorted(r[k] for r in rows)
+        print('  %-10s media %8d  p50 %8d  max %8d' % (
+            col, sum(values) // len(values), values[len(values) // 2], values[-1]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('file', nargs='?', help='despejo salvo (padrão: entrada padrão)')
+    parser.add_argument('--port', help='porta serial da placa, ex. /dev/ttyACM0')
+    parser.add_argument('--window-ms', type=int, default=100,
+                        help='maior atraso para ligar uma entrada a um quadro (padrão 100)')
+    args = parser.parse_args()
+
+    events = parse(read_lines(args))
+    window = args.window_ms * 1000
+    led_cols = ['->app', 'compor', 'fila', 'ate DMA', 'fio+reset', 'total']
+    oled_cols = ['->saida', 'desenho', 'I2C', 'total']
+
+    print('%-16s %12s | matriz: %s | display: %s' % (
+        'entrada', 'us', ' '.join('%8s' % c for c in led_cols), ' '.join('%8s' % c for c in oled_cols)))
+    led_rows, oled_rows = [], []
+    for i, e in enumerate(events):
+        if e.id not in (BUTTON_EDGE, JOYSTICK):
+            continue
+        led = led_chain(events, i, e, window)
+        oled = oled_chain(events, i, e, window)
+        led_rows += [led] if led else []
+        oled_rows += [oled] if oled else []
+        print('%-16s %12d | %s | %s' % (describe(e), e.ts, fmt(led), fmt(oled)))
+
+    summary('Entrada -> LEDs', led_rows, led_cols)
+    summary('Entrada -> display', oled_rows, oled_cols)
+
+
+if __name__ == '__main__':
+    main()